@@ -0,0 +1,1849 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTBench.cpp
+ *
+ * @brief Benchmark driver for the BST class
+ *
+ * @details Times BST class operations on generated StudentType records,
+ *          using the SimpleTimer class for evaluation
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires iostream.h, cstdio, StudentType.h, SimpleTimer.h,
+ *       BSTClass.cpp, BTreeClass.cpp, SkipListClass.cpp
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+   // None
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <cstdio>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "StudentType.h"
+#include "SimpleTimer.h"
+#include "BSTClass.cpp"
+#include "BTreeClass.cpp"
+#include "SkipListClass.cpp"
+
+using namespace std;
+
+// Global constant definitions  ///////////////////////////////////////////////
+
+const char ENDLINE_CHAR = '\n';
+const int MAX_NAME_LEN = 50;
+const int MAX_TIME_LEN = 30;
+const int DEFAULT_RECORDS = 1000000;
+
+const int RANDOM_SEED = 7;
+
+const int MAX_MIXED_THREADS = 64;
+const int PERCENT = 100;
+
+const int ORDER_QUERIES = 100000;
+const int WALK_QUERIES = 20;
+const int RANGE_QUERIES = 10000;
+const int RANGE_WIDTH = 100;
+const int LOOKUP_BATCH = 1024;
+const int SPLIT_QUERIES = 10000;
+const int DEGENERATE_RECORDS = 5000;
+const int DISPLAY_DEPTH = 8;
+
+const char NULL_DEVICE[] = "/dev/null";
+
+enum bCodes { DUMMY, SORTED_INGEST_BST, SORTED_INGEST_AVL, 
+                                   COMPARES_SORTED_BST, COMPARES_RANDOM_BST,
+                                   INGEST_CLEAR_HEAP, INGEST_CLEAR_SLAB,
+                                   LOOKUP_AVL, LOOKUP_BTREE, LOOKUP_FROZEN,
+                                   BULK_BUILD_SORTED, BULK_BUILD_RANDOM,
+                                   PARALLEL_BUILD_SCALING, 
+                                   TRAVERSAL_OUTPUT, PARALLEL_REDUCE_SCALING,
+                                   CONCURRENT_LOOKUPS, LOCK_FREE_MIXED,
+                                   SNAPSHOT_COST, PARALLEL_COPY_CLEAR,
+                                   DEFERRED_CLEAR, ORDER_STATISTICS,
+                                   RANGE_SCANS, BATCH_LOOKUPS,
+                                   SPLIT_JOIN_MERGE, SET_ALGEBRA,
+                                   STRUCTURE_DISPLAY, SHAPE_STATS };
+
+// Free function objects  /////////////////////////////////////////////////////
+
+// formats each record and counts those before a pivot record
+struct CountBefore
+   {
+    const StudentType *pivot;
+
+    void operator () ( long long &count, const StudentType &item ) const
+       {
+        char itemStr[ MAX_NAME_LEN ];
+
+        item.toString( itemStr );
+
+        if( item.compareTo( *pivot ) < 0 )
+           {
+            count++;
+           }
+       }
+   };
+
+// counts records passed to it
+struct CountItems
+   {
+    long long *count;
+
+    void operator () ( const StudentType &item ) const
+       {
+        ( *count )++;
+       }
+   };
+
+struct AddCounts
+   {
+    void operator () ( long long &count, const long long &otherCount ) const
+       {
+        count += otherCount;
+       }
+   };
+
+// Free function prototypes  //////////////////////////////////////////////////
+
+int getControlCode( istream &consoleIn, int &numRecords );
+void makeRecords( StudentType *records, int numRecords );
+void shuffleRecords( StudentType *records, int numRecords );
+void timeSortedIngest( const StudentType *records, int numRecords,
+                                                              int options );
+void countCompares( const StudentType *records, int numRecords, 
+                                                              int options );
+void timeIngestAndClear( const StudentType *records, int numRecords, 
+                                                              int options );
+template <typename TreeType>
+void timeLookups( TreeType &tree, const StudentType *records, 
+                                                            int numRecords );
+void timeFrozenLookups( const StudentType *records, int numRecords );
+void timeBulkBuild( const StudentType *records, int numRecords );
+void timeParallelBuild( const StudentType *records, int numRecords );
+void timeTraversalOutput( const StudentType *records, int numRecords );
+void timeParallelReduce( const StudentType *records, int numRecords );
+void lookupWorker( const BSTClass<StudentType> *tree, 
+                   const StudentType *records, int numRecords,
+                   int firstIndex, int lookupCount, mutex *globalLock );
+void ingestWorker( BSTClass<StudentType> *tree, const StudentType *records,
+                   int numRecords, atomic<bool> *stopFlag, 
+                   long long *ingestCount, mutex *globalLock );
+void runConcurrentLookups( BSTClass<StudentType> &tree, 
+                           const StudentType *records, int numRecords,
+                           int numThreads, mutex *globalLock );
+void timeConcurrentLookups( const StudentType *records, int numRecords );
+template <typename SetType>
+void mixedWorker( SetType *set, const StudentType *records, int numRecords,
+                  int threadIndex, int opCount, int findPercent );
+template <typename SetType>
+void runMixedWorkload( SetType &set, const StudentType *records, 
+                       int numRecords, int numThreads, int findPercent );
+void timeLockFreeMixed( const StudentType *records, int numRecords );
+void timeUpdates( BSTClass<StudentType> &tree, const StudentType *records,
+                                                            int numRecords );
+void timeSnapshots( const StudentType *records, int numRecords );
+void timeCopyAndClear( const StudentType *records, int numRecords, 
+                                                              int options );
+void timeDeferredClear( const StudentType *records, int numRecords, 
+                                                              int options );
+void timeOrderStatistics( const StudentType *records, int numRecords );
+void timeRangeScans( const StudentType *records, int numRecords );
+void timeBatchLookups( const StudentType *records, int numRecords );
+void timeSplitJoinMerge( const StudentType *records, int numRecords );
+void timeSetAlgebra( const StudentType *records, int numRecords );
+void timeStructureDisplay( const StudentType *records, int numRecords );
+void timeShapeStats( const StudentType *records, int numRecords, 
+                                                              int options );
+void displayStats( const BSTStats &stats );
+int getMaxThreads();
+void displayCodeChoices();
+
+// Main function implementation  //////////////////////////////////////////////
+
+int main()
+   {
+    StudentType *records;
+    int controlCode, numRecords = DEFAULT_RECORDS;
+
+    displayCodeChoices();
+
+    controlCode = getControlCode( cin, numRecords );
+
+    cout << controlCode << ' ' << numRecords << endl;
+
+    records = new StudentType[ numRecords ];
+
+    makeRecords( records, numRecords );
+
+    switch( controlCode )
+       {
+        case SORTED_INGEST_BST:
+
+           cout << endl << "Sorted ingest, unbalanced: " << endl;
+
+           timeSortedIngest( records, numRecords,
+                                      BSTClass<StudentType>::UNBALANCED );
+
+           break;
+
+        case SORTED_INGEST_AVL:
+
+           cout << endl << "Sorted ingest, AVL balanced: " << endl;
+
+           timeSortedIngest( records, numRecords,
+                                     BSTClass<StudentType>::AVL_BALANCE );
+
+           break;
+
+        case COMPARES_SORTED_BST:
+
+           cout << endl << "Comparison count, sorted input: " << endl;
+
+           countCompares( records, numRecords, 
+                                      BSTClass<StudentType>::UNBALANCED );
+
+           break;
+
+        case COMPARES_RANDOM_BST:
+
+           cout << endl << "Comparison count, random input: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           countCompares( records, numRecords, 
+                                      BSTClass<StudentType>::UNBALANCED );
+
+           break;
+
+        case INGEST_CLEAR_HEAP:
+
+           cout << endl << "Random ingest and clear, heap nodes: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeIngestAndClear( records, numRecords, 
+                                     BSTClass<StudentType>::AVL_BALANCE );
+
+           break;
+
+        case INGEST_CLEAR_SLAB:
+
+           cout << endl << "Random ingest and clear, slab nodes: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeIngestAndClear( records, numRecords, 
+                                    BSTClass<StudentType>::AVL_BALANCE 
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+
+           break;
+
+        case LOOKUP_AVL:
+
+           cout << endl << "Random lookups, AVL BSTClass: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+              {
+               BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+
+               timeLookups( tree, records, numRecords );
+              }
+
+           break;
+
+        case LOOKUP_BTREE:
+
+           cout << endl << "Random lookups, BTreeClass: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+              {
+               BTreeClass<StudentType> tree;
+
+               timeLookups( tree, records, numRecords );
+              }
+
+           break;
+
+        case LOOKUP_FROZEN:
+
+           cout << endl << "Random lookups, frozen snapshot: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeFrozenLookups( records, numRecords );
+
+           break;
+
+        case BULK_BUILD_SORTED:
+
+           cout << endl << "Bulk build, sorted input: " << endl;
+
+           timeBulkBuild( records, numRecords );
+
+           break;
+
+        case BULK_BUILD_RANDOM:
+
+           cout << endl << "Bulk build, random input: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeBulkBuild( records, numRecords );
+
+           break;
+
+        case PARALLEL_BUILD_SCALING:
+
+           cout << endl << "Parallel bulk build, random input: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeParallelBuild( records, numRecords );
+
+           break;
+
+        case TRAVERSAL_OUTPUT:
+
+           cout << endl << "In order traversal output: " << endl;
+
+           timeTraversalOutput( records, numRecords );
+
+           break;
+
+        case PARALLEL_REDUCE_SCALING:
+
+           cout << endl << "Parallel reduce over whole tree: " << endl;
+
+           timeParallelReduce( records, numRecords );
+
+           break;
+
+        case CONCURRENT_LOOKUPS:
+
+           cout << endl << "Concurrent lookups with one ingest thread: " 
+                << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeConcurrentLookups( records, numRecords );
+
+           break;
+
+        case LOCK_FREE_MIXED:
+
+           cout << endl << "Mixed workloads, skip list against locked tree: "
+                << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeLockFreeMixed( records, numRecords );
+
+           break;
+
+        case SNAPSHOT_COST:
+
+           cout << endl << "Snapshot against full copy: " << endl;
+
+           timeSnapshots( records, numRecords );
+
+           break;
+
+        case PARALLEL_COPY_CLEAR:
+
+           cout << endl << "Parallel copy and clear, heap nodes: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeCopyAndClear( records, numRecords, 
+                                      BSTClass<StudentType>::AVL_BALANCE );
+
+           cout << endl << "Parallel copy and clear, slab nodes: " << endl;
+
+           timeCopyAndClear( records, numRecords, 
+                                      BSTClass<StudentType>::AVL_BALANCE 
+                                      | BSTClass<StudentType>::SLAB_ALLOC );
+
+           break;
+
+        case DEFERRED_CLEAR:
+
+           cout << endl << "Deferred clear, heap nodes: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeDeferredClear( records, numRecords, 
+                                      BSTClass<StudentType>::AVL_BALANCE );
+
+           cout << endl << "Deferred clear, shared nodes: " << endl;
+
+           timeDeferredClear( records, numRecords, 
+                                      BSTClass<StudentType>::AVL_BALANCE 
+                                      | BSTClass<StudentType>::PERSISTENT );
+
+           break;
+
+        case ORDER_STATISTICS:
+
+           cout << endl << "Rank and select against in order walk: " << endl;
+
+           timeOrderStatistics( records, numRecords );
+
+           break;
+
+        case RANGE_SCANS:
+
+           cout << endl << "Range scans against filtered full walk: " << endl;
+
+           timeRangeScans( records, numRecords );
+
+           break;
+
+        case BATCH_LOOKUPS:
+
+           cout << endl << "Batched lookups against single finds: " << endl;
+
+           shuffleRecords( records, numRecords );
+
+           timeBatchLookups( records, numRecords );
+
+           break;
+
+        case SPLIT_JOIN_MERGE:
+
+           cout << endl << "Split, join and merge of shard trees: " << endl;
+
+           timeSplitJoinMerge( records, numRecords );
+
+           break;
+
+        case SET_ALGEBRA:
+
+           cout << endl << "Set difference against find loop: " << endl;
+
+           timeSetAlgebra( records, numRecords );
+
+           break;
+
+        case STRUCTURE_DISPLAY:
+
+           cout << endl << "Structure display of large trees: " << endl;
+
+           timeStructureDisplay( records, numRecords );
+
+           break;
+
+        case SHAPE_STATS:
+
+           cout << endl << "Shape and cost statistics, random input: " 
+                << endl;
+
+           shuffleRecords( records, numRecords );
+
+           cout << endl << "Unbalanced:" << endl;
+
+           timeShapeStats( records, numRecords, 
+                                      BSTClass<StudentType>::UNBALANCED );
+
+           cout << endl << "AVL balanced:" << endl;
+
+           timeShapeStats( records, numRecords, 
+                                     BSTClass<StudentType>::AVL_BALANCE );
+
+           break;
+       }
+
+    delete [] records;
+
+    return 0;
+   }
+
+void displayCodeChoices()
+   {
+    cout << "Here is the list of codes for the various benchmarks:" << endl;
+
+    cout << "Sorted ingest, unbalanced tree    : "
+         << SORTED_INGEST_BST << endl;
+    cout << "Sorted ingest, AVL balanced tree  : "
+         << SORTED_INGEST_AVL << endl;
+    cout << "Comparison count, sorted input    : "
+         << COMPARES_SORTED_BST << endl;
+    cout << "Comparison count, random input    : "
+         << COMPARES_RANDOM_BST << endl;
+    cout << "Ingest and clear, heap nodes      : "
+         << INGEST_CLEAR_HEAP << endl;
+    cout << "Ingest and clear, slab nodes      : "
+         << INGEST_CLEAR_SLAB << endl;
+    cout << "Random lookups, AVL BSTClass      : "
+         << LOOKUP_AVL << endl;
+    cout << "Random lookups, BTreeClass        : "
+         << LOOKUP_BTREE << endl;
+    cout << "Random lookups, frozen snapshot   : "
+         << LOOKUP_FROZEN << endl;
+    cout << "Bulk build, sorted input          : "
+         << BULK_BUILD_SORTED << endl;
+    cout << "Bulk build, random input          : "
+         << BULK_BUILD_RANDOM << endl;
+    cout << "Parallel bulk build scaling       : "
+         << PARALLEL_BUILD_SCALING << endl;
+    cout << "Traversal output, flush per line  : "
+         << TRAVERSAL_OUTPUT << endl;
+    cout << "Parallel reduce scaling           : "
+         << PARALLEL_REDUCE_SCALING << endl;
+    cout << "Concurrent lookups, one writer    : "
+         << CONCURRENT_LOOKUPS << endl;
+    cout << "Mixed workloads, lock free list   : "
+         << LOCK_FREE_MIXED << endl;
+    cout << "Snapshot against full copy        : "
+         << SNAPSHOT_COST << endl;
+    cout << "Parallel copy and clear scaling   : "
+         << PARALLEL_COPY_CLEAR << endl;
+    cout << "Deferred clear and destruction    : "
+         << DEFERRED_CLEAR << endl;
+    cout << "Rank and select queries           : "
+         << ORDER_STATISTICS << endl;
+    cout << "Range scans                       : "
+         << RANGE_SCANS << endl;
+    cout << "Batched lookups, use 4M+ records  : "
+         << BATCH_LOOKUPS << endl;
+    cout << "Split, join and merge             : "
+         << SPLIT_JOIN_MERGE << endl;
+    cout << "Set algebra                       : "
+         << SET_ALGEBRA << endl;
+    cout << "Structure display                 : "
+         << STRUCTURE_DISPLAY << endl;
+    cout << "Shape and cost statistics         : "
+         << SHAPE_STATS << endl;
+    cout << endl << "Enter code number and record count: ";
+   }
+
+int getControlCode( istream &consoleIn, int &numRecords )
+   {
+    char inChar = ' ';
+    int codeNum = DUMMY;
+
+    consoleIn >> codeNum;
+
+    while( consoleIn.get( inChar ) && inChar == ' ' )
+       {
+        // skip separating spaces
+       }
+
+    if( inChar != ENDLINE_CHAR && consoleIn )
+       {
+        consoleIn.putback( inChar );
+
+        consoleIn >> numRecords;
+       }
+
+    return codeNum;
+   }
+
+void makeRecords( StudentType *records, int numRecords )
+   {
+    char name[ MAX_NAME_LEN ];
+    int index;
+
+    // fixed width numbers keep the names in sorted order
+    for( index = 0; index < numRecords; index++ )
+       {
+        sprintf( name, "Student%09d, Test", index );
+
+        records[ index ].setStudentData( name, index, 'F' );
+       }
+   }
+
+void timeSortedIngest( const StudentType *records, int numRecords,
+                                                               int options )
+   {
+    BSTClass<StudentType> tree( options );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index;
+
+    timer.start();
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Inserted " << numRecords << " sorted records in "
+         << timeStr << " seconds" << endl;
+   }
+
+void shuffleRecords( StudentType *records, int numRecords )
+   {
+    StudentType temp;
+    int index, swapIndex;
+
+    srand( RANDOM_SEED );
+
+    for( index = numRecords - 1; index > 0; index-- )
+       {
+        swapIndex = rand() % ( index + 1 );
+
+        temp = records[ index ];
+        records[ index ] = records[ swapIndex ];
+        records[ swapIndex ] = temp;
+       }
+   }
+
+void countCompares( const StudentType *records, int numRecords, 
+                                                               int options )
+   {
+    BSTClass<StudentType> tree( options );
+    StudentType searchItem;
+    int index;
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    cout << "Insert: " << tree.getCompareCount() << " comparisons, "
+         << double( tree.getCompareCount() ) / numRecords << " per call" 
+         << endl;
+
+    tree.resetCompareCount();
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        searchItem = records[ index ];
+
+        tree.find( searchItem );
+       }
+
+    cout << "Find:   " << tree.getCompareCount() << " comparisons, "
+         << double( tree.getCompareCount() ) / numRecords << " per call" 
+         << endl;
+
+    tree.resetCompareCount();
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.remove( records[ index ] );
+       }
+
+    cout << "Remove: " << tree.getCompareCount() << " comparisons, "
+         << double( tree.getCompareCount() ) / numRecords << " per call" 
+         << endl;
+   }
+
+void timeIngestAndClear( const StudentType *records, int numRecords, 
+                                                               int options )
+   {
+    BSTClass<StudentType> tree( options );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index;
+
+    timer.start();
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Inserted " << numRecords << " records in "
+         << timeStr << " seconds" << endl;
+
+    timer.start();
+
+    tree.clear();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Cleared tree in " << timeStr << " seconds" << endl;
+   }
+
+template <typename TreeType>
+void timeLookups( TreeType &tree, const StudentType *records, 
+                                                             int numRecords )
+   {
+    SimpleTimer timer;
+    StudentType searchItem;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, foundCount = 0;
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    // search in a different order than the records were inserted
+    timer.start();
+
+    // both passes look up in insert order, a fresh path every time
+    for( index = 0; index < numRecords; index++ )
+       {
+        searchItem = records[ index ];
+
+        if( tree.find( searchItem ) )
+           {
+            foundCount++;
+           }
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Found " << foundCount << " of " << numRecords << " keys in "
+         << timeStr << " seconds" << endl;
+   }
+
+void timeFrozenLookups( const StudentType *records, int numRecords )
+   {
+    FrozenBSTClass<StudentType> frozen;
+    SimpleTimer timer;
+    StudentType searchItem;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, foundCount = 0;
+
+       {
+        BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+
+        for( index = 0; index < numRecords; index++ )
+           {
+            tree.insert( records[ index ] );
+           }
+
+        frozen = tree.freeze();
+       }
+
+    timer.start();
+
+    for( index = numRecords - 1; index >= 0; index-- )
+       {
+        searchItem = records[ index ];
+
+        if( frozen.find( searchItem ) )
+           {
+            foundCount++;
+           }
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Found " << foundCount << " of " << numRecords << " keys in "
+         << timeStr << " seconds" << endl;
+   }
+
+void timeBulkBuild( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+
+    timer.start();
+
+    tree.buildFromSorted( records, numRecords );
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Built tree of " << numRecords << " records in "
+         << timeStr << " seconds" << endl;
+   }
+
+int getMaxThreads()
+   {
+    const int MIN_THREADS = 8;
+    int hardwareThreads = int( thread::hardware_concurrency() );
+
+    if( hardwareThreads < MIN_THREADS )
+       {
+        return MIN_THREADS;
+       }
+
+    return hardwareThreads;
+   }
+
+void timeParallelBuild( const StudentType *records, int numRecords )
+   {
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int numThreads, maxThreads = getMaxThreads();
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+
+        timer.start();
+
+        tree.buildFromUnsorted( records, numRecords, numThreads );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << numThreads << " threads: built tree of " << numRecords 
+             << " records in " << timeStr << " seconds" << endl;
+       }
+   }
+
+void timeTraversalOutput( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+    BSTClass<StudentType>::const_iterator iter;
+    ofstream outFile( NULL_DEVICE );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ], itemStr[ MAX_NAME_LEN ];
+
+    tree.buildFromSorted( records, numRecords );
+
+    // same per item work as the original traversal helpers
+    timer.start();
+
+    for( iter = tree.begin(); iter != tree.end(); ++iter )
+       {
+        iter->toString( itemStr );
+
+        outFile << itemStr << endl;
+       }
+
+    outFile << endl;
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Flush per line: " << timeStr << " seconds" << endl;
+
+    timer.start();
+
+    tree.inOrderTraversal( outFile );
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Buffered:       " << timeStr << " seconds" << endl;
+   }
+
+void timeParallelReduce( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+    BSTClass<StudentType>::const_iterator iter;
+    CountBefore countBefore;
+    AddCounts addCounts;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    long long count = 0;
+    int numThreads, maxThreads = getMaxThreads();
+
+    tree.buildFromSorted( records, numRecords );
+
+    countBefore.pivot = &records[ numRecords / 2 ];
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+    timer.start();
+
+    for( iter = tree.begin(); iter != tree.end(); ++iter )
+       {
+        countBefore( count, *iter );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Sequential: counted " << count << " in " 
+         << timeStr << " seconds" << endl;
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTThreadPool pool( numThreads );
+
+        timer.start();
+
+        count = tree.parallelReduce( 0LL, countBefore, addCounts, 
+                                                           false, pool );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << numThreads << " threads: counted " << count << " in "
+             << timeStr << " seconds" << endl;
+       }
+   }
+
+void lookupWorker( const BSTClass<StudentType> *tree, 
+                   const StudentType *records, int numRecords,
+                   int firstIndex, int lookupCount, mutex *globalLock )
+   {
+    StudentType searchItem;
+    int index;
+
+    for( index = 0; index < lookupCount; index++ )
+       {
+        searchItem = records[ ( firstIndex + index ) % numRecords ];
+
+        if( globalLock != NULL )
+           {
+            lock_guard<mutex> lockGuard( *globalLock );
+
+            tree->find( searchItem );
+           }
+
+        else
+           {
+            tree->find( searchItem );
+           }
+       }
+   }
+
+void ingestWorker( BSTClass<StudentType> *tree, const StudentType *records,
+                   int numRecords, atomic<bool> *stopFlag, 
+                   long long *ingestCount, mutex *globalLock )
+   {
+    int index = 0;
+
+    while( !*stopFlag )
+       {
+        if( globalLock != NULL )
+           {
+            lock_guard<mutex> lockGuard( *globalLock );
+
+            tree->remove( records[ index ] );
+            tree->insert( records[ index ] );
+           }
+
+        else
+           {
+            tree->remove( records[ index ] );
+            tree->insert( records[ index ] );
+           }
+
+        index = ( index + 1 ) % numRecords;
+
+        ( *ingestCount )++;
+       }
+   }
+
+void runConcurrentLookups( BSTClass<StudentType> &tree, 
+                           const StudentType *records, int numRecords,
+                           int numThreads, mutex *globalLock )
+   {
+    vector<thread> readers;
+    thread writer;
+    atomic<bool> stopFlag( false );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    long long ingestCount = 0;
+    int index;
+
+    timer.start();
+
+    writer = thread( ingestWorker, &tree, records, numRecords, &stopFlag,
+                                                   &ingestCount, globalLock );
+
+    for( index = 0; index < numThreads; index++ )
+       {
+        readers.push_back( thread( lookupWorker, &tree, records, numRecords,
+                                   numRecords / numThreads * index, 
+                                   numRecords / numThreads, globalLock ) );
+       }
+
+    for( index = 0; index < numThreads; index++ )
+       {
+        readers[ index ].join();
+       }
+
+    timer.stop();
+
+    stopFlag = true;
+
+    writer.join();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << numThreads << " readers: " << numRecords / numThreads * numThreads
+         << " finds and " << ingestCount << " remove/insert pairs in " 
+         << timeStr << " seconds" << endl;
+   }
+
+void timeConcurrentLookups( const StudentType *records, int numRecords )
+   {
+    int numThreads, maxThreads = getMaxThreads();
+    mutex globalLock;
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+    cout << "Global mutex around an unsynchronized tree:" << endl;
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC );
+
+        tree.buildFromSorted( records, numRecords );
+
+        runConcurrentLookups( tree, records, numRecords, numThreads, 
+                                                               &globalLock );
+       }
+
+    cout << "THREAD_SAFE tree:" << endl;
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::SLAB_ALLOC
+                                    | BSTClass<StudentType>::THREAD_SAFE );
+
+        tree.buildFromSorted( records, numRecords );
+
+        runConcurrentLookups( tree, records, numRecords, numThreads, NULL );
+       }
+   }
+
+template <typename SetType>
+void mixedWorker( SetType *set, const StudentType *records, int numRecords,
+                  int threadIndex, int opCount, int findPercent )
+   {
+    StudentType searchItem;
+    unsigned int randomState = RANDOM_SEED + 2 * threadIndex + 1;
+    int index, recordIndex, choice;
+
+    for( index = 0; index < opCount; index++ )
+       {
+        // xorshift, rand() would serialize the threads on its own lock
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+
+        recordIndex = int( randomState % unsigned( numRecords ) );
+        choice = int( ( randomState >> 16 ) % PERCENT );
+
+        if( choice < findPercent )
+           {
+            searchItem = records[ recordIndex ];
+
+            set->find( searchItem );
+           }
+
+        else if( ( choice - findPercent ) % 2 == 0 )
+           {
+            set->insert( records[ recordIndex ] );
+           }
+
+        else
+           {
+            set->remove( records[ recordIndex ] );
+           }
+       }
+   }
+
+template <typename SetType>
+void runMixedWorkload( SetType &set, const StudentType *records, 
+                       int numRecords, int numThreads, int findPercent )
+   {
+    vector<thread> workers;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, opCount = numRecords / numThreads;
+
+    timer.start();
+
+    for( index = 0; index < numThreads; index++ )
+       {
+        workers.push_back( thread( mixedWorker<SetType>, &set, records, 
+                                   numRecords, index, opCount, 
+                                                             findPercent ) );
+       }
+
+    for( index = 0; index < numThreads; index++ )
+       {
+        workers[ index ].join();
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << numThreads << " threads: " << opCount * numThreads 
+         << " operations in " << timeStr << " seconds" << endl;
+   }
+
+void timeLockFreeMixed( const StudentType *records, int numRecords )
+   {
+    const int FIND_PERCENTS[] = { 90, 50 };
+    const int NUM_MIXES = 2;
+    int mixIndex, findPercent, numThreads, index;
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+    for( mixIndex = 0; mixIndex < NUM_MIXES; mixIndex++ )
+       {
+        findPercent = FIND_PERCENTS[ mixIndex ];
+
+        cout << findPercent << "% finds, " 
+             << ( PERCENT - findPercent ) / 2 << "% inserts, "
+             << ( PERCENT - findPercent ) / 2 << "% removes" << endl;
+
+        cout << "THREAD_SAFE tree:" << endl;
+
+        for( numThreads = 1; numThreads <= MAX_MIXED_THREADS; 
+                                                            numThreads *= 2 )
+           {
+            BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE
+                                        | BSTClass<StudentType>::SLAB_ALLOC
+                                        | BSTClass<StudentType>::THREAD_SAFE );
+
+            tree.buildFromUnsorted( records, numRecords / 2, 1 );
+
+            runMixedWorkload( tree, records, numRecords, numThreads, 
+                                                               findPercent );
+           }
+
+        cout << "Lock free skip list:" << endl;
+
+        for( numThreads = 1; numThreads <= MAX_MIXED_THREADS; 
+                                                            numThreads *= 2 )
+           {
+            SkipListClass<StudentType> list;
+
+            for( index = 0; index < numRecords / 2; index++ )
+               {
+                list.insert( records[ index ] );
+               }
+
+            runMixedWorkload( list, records, numRecords, numThreads, 
+                                                               findPercent );
+           }
+       }
+   }
+
+void timeUpdates( BSTClass<StudentType> &tree, const StudentType *records,
+                                                            int numRecords )
+   {
+    const int UPDATE_COUNT = 10000;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, recordIndex;
+
+    timer.start();
+
+    for( index = 0; index < UPDATE_COUNT; index++ )
+       {
+        recordIndex = int( ( long long )index * 7919 % numRecords );
+
+        tree.remove( records[ recordIndex ] );
+        tree.insert( records[ recordIndex ] );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "   " << UPDATE_COUNT << " remove/insert pairs after: "
+         << timeStr << " seconds" << endl;
+   }
+
+void timeSnapshots( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType> persistentTree( BSTClass<StudentType>::AVL_BALANCE
+                                    | BSTClass<StudentType>::PERSISTENT );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+
+    tree.buildFromSorted( records, numRecords );
+    persistentTree.buildFromSorted( records, numRecords );
+
+    timer.start();
+
+       {
+        BSTClass<StudentType> copied( tree );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "Copy constructor: " << timeStr << " seconds" << endl;
+
+        timeUpdates( tree, records, numRecords );
+       }
+
+    timer.start();
+
+       {
+        BSTClass<StudentType> version = persistentTree.snapshot();
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "PERSISTENT snapshot: " << timeStr << " seconds" << endl;
+
+        timeUpdates( persistentTree, records, numRecords );
+       }
+   }
+
+void timeCopyAndClear( const StudentType *records, int numRecords, 
+                                                              int options )
+   {
+    BSTClass<StudentType> tree( options );
+    SimpleTimer timer;
+    char copyTimeStr[ MAX_TIME_LEN ], clearTimeStr[ MAX_TIME_LEN ];
+    int numThreads, maxThreads = getMaxThreads();
+
+    tree.buildFromUnsorted( records, numRecords, 1 );
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+       {
+        timer.start();
+
+        BSTClass<StudentType> copied( tree );
+
+        timer.stop();
+
+        timer.getElapsedTime( copyTimeStr );
+
+        timer.start();
+
+        copied.clear();
+
+        timer.stop();
+
+        timer.getElapsedTime( clearTimeStr );
+
+        cout << "Sequential: copy " << copyTimeStr << ", clear " 
+             << clearTimeStr << " seconds" << endl;
+       }
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTThreadPool pool( numThreads );
+
+        timer.start();
+
+        BSTClass<StudentType> copied( tree, pool );
+
+        timer.stop();
+
+        timer.getElapsedTime( copyTimeStr );
+
+        timer.start();
+
+        copied.parallelClear( pool );
+
+        timer.stop();
+
+        timer.getElapsedTime( clearTimeStr );
+
+        cout << numThreads << " threads: copy " << copyTimeStr << ", clear "
+             << clearTimeStr << " seconds" << endl;
+       }
+   }
+
+void timeDeferredClear( const StudentType *records, int numRecords, 
+                                                              int options )
+   {
+    int deferOptions = options | BSTClass<StudentType>::DEFERRED_FREE;
+    BSTClass<StudentType> inlineTree( options );
+    BSTClass<StudentType> deferredTree( deferOptions );
+    BSTClass<StudentType> secondTree( deferOptions );
+    BSTClass<StudentType> *droppedTree;
+    BSTReclaimer &reclaimer = BSTReclaimer::getShared();
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    size_t treeBytes = size_t( numRecords ) * sizeof( BSTNode<StudentType> );
+
+    inlineTree.buildFromUnsorted( records, numRecords, 1 );
+
+    timer.start();
+
+    inlineTree.clear();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Inline clear: " << timeStr << " seconds" << endl;
+
+    deferredTree.buildFromUnsorted( records, numRecords, 1 );
+
+    timer.start();
+
+    deferredTree.clear();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Deferred clear: " << timeStr << " seconds" << endl;
+
+    timer.start();
+
+    reclaimer.drain();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Background free, after clear returned: " << timeStr 
+         << " seconds" << endl;
+
+    droppedTree = new BSTClass<StudentType>( deferOptions );
+
+    droppedTree->buildFromUnsorted( records, numRecords, 1 );
+
+    timer.start();
+
+    delete droppedTree;
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Deferred destructor: " << timeStr << " seconds" << endl;
+
+    // second clear has to wait for room while the first is pending
+    reclaimer.drain();
+    reclaimer.setPendingLimit( treeBytes + treeBytes / 2 );
+
+    deferredTree.buildFromUnsorted( records, numRecords, 1 );
+    secondTree.buildFromUnsorted( records, numRecords, 1 );
+
+    timer.start();
+
+    deferredTree.clear();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Limit of 1.5 trees, first clear: " << timeStr 
+         << " seconds" << endl;
+
+    timer.start();
+
+    secondTree.clear();
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Limit of 1.5 trees, second clear: " << timeStr 
+         << " seconds" << endl;
+
+    reclaimer.drain();
+    reclaimer.setPendingLimit( BSTReclaimer::DEFAULT_PENDING_LIMIT );
+   }
+
+void timeOrderStatistics( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType>::const_iterator iter;
+    StudentType foundItem;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    long long checkSum = 0;
+    int index, position;
+
+    tree.buildFromSorted( records, numRecords );
+
+    cout << "Tree size: " << tree.size() << endl;
+
+    timer.start();
+
+    for( index = 0; index < ORDER_QUERIES; index++ )
+       {
+        checkSum += tree.rank( records[ rand() % numRecords ] );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << ORDER_QUERIES << " rank queries: " << timeStr << " seconds" 
+         << endl;
+
+    timer.start();
+
+    for( index = 0; index < ORDER_QUERIES; index++ )
+       {
+        checkSum += tree.select( rand() % numRecords, foundItem );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << ORDER_QUERIES << " select queries: " << timeStr << " seconds" 
+         << endl;
+
+    timer.start();
+
+    for( index = 0; index < WALK_QUERIES; index++ )
+       {
+        position = rand() % numRecords;
+
+        for( iter = tree.begin(); position > 0; ++iter )
+           {
+            position--;
+           }
+
+        checkSum += iter->compareTo( foundItem );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << WALK_QUERIES << " in order walks to a position: " << timeStr 
+         << " seconds" << endl;
+
+    cout << "Checksum: " << checkSum << endl;
+   }
+
+void timeRangeScans( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType>::const_iterator iter;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    long long rangeCount = 0, walkCount = 0;
+    CountItems counter;
+    int index, low, high;
+
+    // records are made in sorted order, so index ranges are key ranges
+    tree.buildFromSorted( records, numRecords );
+
+    counter.count = &rangeCount;
+
+    timer.start();
+
+    for( index = 0; index < RANGE_QUERIES; index++ )
+       {
+        low = rand() % numRecords;
+        high = min( low + RANGE_WIDTH - 1, numRecords - 1 );
+
+        tree.forEachInRange( records[ low ], records[ high ], counter );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << RANGE_QUERIES << " scans of " << RANGE_WIDTH << " items: " 
+         << timeStr << " seconds, " << rangeCount << " items" << endl;
+
+    timer.start();
+
+    for( index = 0; index < WALK_QUERIES; index++ )
+       {
+        low = rand() % numRecords;
+        high = min( low + RANGE_WIDTH - 1, numRecords - 1 );
+
+        for( iter = tree.begin(); iter != tree.end(); ++iter )
+           {
+            if( iter->compareTo( records[ low ] ) >= 0
+                               && iter->compareTo( records[ high ] ) <= 0 )
+               {
+                walkCount++;
+               }
+           }
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << WALK_QUERIES << " filtered full walks: " << timeStr 
+         << " seconds, " << walkCount << " items" << endl;
+   }
+
+void timeBatchLookups( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> tree( BSTClass<StudentType>::AVL_BALANCE );
+    StudentType searchItem;
+    bool foundFlags[ LOOKUP_BATCH ];
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, batchSize, foundCount = 0;
+
+    // shuffled inserts scatter the nodes over the heap
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    cout << "Tree nodes take about " 
+         << ( long long )numRecords * sizeof( BSTNode<StudentType> ) / 1048576
+         << " MB" << endl;
+
+    timer.start();
+
+    // both passes look up in insert order, a fresh path every time
+    for( index = 0; index < numRecords; index++ )
+       {
+        searchItem = records[ index ];
+
+        if( tree.find( searchItem ) )
+           {
+            foundCount++;
+           }
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Single finds: found " << foundCount << " in " << timeStr 
+         << " seconds" << endl;
+
+    foundCount = 0;
+
+    timer.start();
+
+    for( index = 0; index < numRecords; index += LOOKUP_BATCH )
+       {
+        batchSize = min( LOOKUP_BATCH, numRecords - index );
+
+        foundCount += tree.findBatch( records + index, foundFlags, 
+                                                               batchSize );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Batches of " << LOOKUP_BATCH << ": found " << foundCount 
+         << " in " << timeStr << " seconds" << endl;
+   }
+
+void timeSplitJoinMerge( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> evenShard( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType> oddShard( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType> highShard;
+    BSTClass<StudentType>::const_iterator iter;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index;
+
+    // shards interleave, the worst case for combining them
+    for( index = 0; index < numRecords; index++ )
+       {
+        if( index % 2 == 0 )
+           {
+            evenShard.insert( records[ index ] );
+           }
+
+        else
+           {
+            oddShard.insert( records[ index ] );
+           }
+       }
+
+       {
+        BSTClass<StudentType> combined( evenShard );
+
+        timer.start();
+
+        for( iter = oddShard.begin(); iter != oddShard.end(); ++iter )
+           {
+            combined.insert( *iter );
+           }
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "Insert one at a time: " << combined.size() << " items in " 
+             << timeStr << " seconds" << endl;
+       }
+
+    timer.start();
+
+    evenShard.merge( oddShard );
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Merge: " << evenShard.size() << " items in " << timeStr 
+         << " seconds" << endl;
+
+    timer.start();
+
+    for( index = 0; index < SPLIT_QUERIES; index++ )
+       {
+        highShard = evenShard.split( records[ rand() % numRecords ] );
+
+        evenShard.join( highShard );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << SPLIT_QUERIES << " split and join pairs: " << timeStr 
+         << " seconds, " << evenShard.size() << " items" << endl;
+   }
+
+void timeSetAlgebra( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> oldTree( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType> newTree( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType>::const_iterator iter;
+    StudentType searchItem;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index, numThreads, maxThreads = getMaxThreads();
+
+    // each snapshot misses a different tenth of the records
+    for( index = 0; index < numRecords; index++ )
+       {
+        if( index % 10 != 3 )
+           {
+            oldTree.insert( records[ index ] );
+           }
+
+        if( index % 10 != 7 )
+           {
+            newTree.insert( records[ index ] );
+           }
+       }
+
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+
+       {
+        BSTClass<StudentType> dropped( BSTClass<StudentType>::AVL_BALANCE );
+
+        timer.start();
+
+        for( iter = oldTree.begin(); iter != oldTree.end(); ++iter )
+           {
+            searchItem = *iter;
+
+            if( !newTree.find( searchItem ) )
+               {
+                dropped.insert( *iter );
+               }
+           }
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "Find loop: " << dropped.size() << " dropped in " << timeStr 
+             << " seconds" << endl;
+       }
+
+       {
+        BSTClass<StudentType> dropped( oldTree );
+
+        timer.start();
+
+        dropped.differenceWith( newTree );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "Sequential difference: " << dropped.size() << " dropped in " 
+             << timeStr << " seconds" << endl;
+       }
+
+    for( numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+       {
+        BSTThreadPool pool( numThreads );
+        BSTClass<StudentType> dropped( oldTree );
+
+        timer.start();
+
+        dropped.differenceWith( newTree, pool );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << numThreads << " threads: " << dropped.size() 
+             << " dropped in " << timeStr << " seconds" << endl;
+       }
+   }
+
+void timeStructureDisplay( const StudentType *records, int numRecords )
+   {
+    BSTClass<StudentType> balanced( BSTClass<StudentType>::AVL_BALANCE );
+    BSTClass<StudentType> degenerate( BSTClass<StudentType>::UNBALANCED );
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index;
+
+    balanced.buildFromSorted( records, numRecords );
+
+    // sorted inserts make a single chain
+    for( index = 0; index < min( numRecords, DEGENERATE_RECORDS ); index++ )
+       {
+        degenerate.insert( records[ index ] );
+       }
+
+       {
+        ostringstream display;
+
+        timer.start();
+
+        balanced.showBSTStructure( display, 'A', DISPLAY_DEPTH );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << numRecords << " nodes, " << DISPLAY_DEPTH << " rows: " 
+             << display.str().size() << " bytes in " << timeStr 
+             << " seconds" << endl;
+       }
+
+       {
+        ostringstream display;
+
+        timer.start();
+
+        balanced.showBSTStructure( display, 'A', 
+                               BSTClass<StudentType>::MAX_STRUCTURE_DEPTH );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << numRecords << " nodes, " 
+             << BSTClass<StudentType>::MAX_STRUCTURE_DEPTH << " rows: " 
+             << display.str().size() << " bytes in " << timeStr 
+             << " seconds" << endl;
+       }
+
+       {
+        ostringstream display;
+
+        timer.start();
+
+        degenerate.showBSTStructure( display, 'D', DISPLAY_DEPTH );
+
+        timer.stop();
+
+        timer.getElapsedTime( timeStr );
+
+        cout << "Chain of " << degenerate.size() << ", " << DISPLAY_DEPTH 
+             << " rows: " << display.str().size() << " bytes in " 
+             << timeStr << " seconds" << endl;
+       }
+   }
+
+void timeShapeStats( const StudentType *records, int numRecords, 
+                                                               int options )
+   {
+    BSTClass<StudentType> tree( options );
+    StudentType searchItem;
+    SimpleTimer timer;
+    char timeStr[ MAX_TIME_LEN ];
+    int index;
+
+    timer.start();
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        tree.insert( records[ index ] );
+       }
+
+    for( index = 0; index < numRecords; index++ )
+       {
+        searchItem = records[ index ];
+
+        tree.find( searchItem );
+       }
+
+    for( index = 0; index < numRecords; index += 2 )
+       {
+        tree.remove( records[ index ] );
+       }
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Insert, find, remove half: " << timeStr << " seconds" << endl;
+
+    timer.start();
+
+    displayStats( tree.getStats() );
+
+    timer.stop();
+
+    timer.getElapsedTime( timeStr );
+
+    cout << "Statistics gathered in " << timeStr << " seconds" << endl;
+   }
+
+void displayStats( const BSTStats &stats )
+   {
+    int depth;
+
+    cout << "Nodes: " << stats.nodeCount << ", height: " << stats.height
+         << ", average path: " << stats.averagePathLength << endl;
+
+    cout << "Nodes per depth:";
+
+    for( depth = 0; depth < int( stats.depthCounts.size() ); depth++ )
+       {
+        cout << ' ' << stats.depthCounts[ depth ];
+       }
+
+    cout << endl;
+
+    if( !stats.countsKept )
+       {
+        cout << "Operation counts off, compile with -DBST_STATS" << endl;
+
+        return;
+       }
+
+    cout << "Find:   " << stats.findCount << " calls, " 
+         << stats.averageFindCompares << " compares average, " 
+         << stats.maxFindCompares << " most" << endl;
+    cout << "Insert: " << stats.insertCount << " calls, " 
+         << stats.averageInsertCompares << " compares average, " 
+         << stats.maxInsertCompares << " most" << endl;
+    cout << "Remove: " << stats.removeCount << " calls, " 
+         << stats.averageRemoveCompares << " compares average, " 
+         << stats.maxRemoveCompares << " most" << endl;
+    cout << "Nodes allocated: " << stats.nodesAllocated << ", freed: " 
+         << stats.nodesFreed << endl;
+   }
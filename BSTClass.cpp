@@ -24,12 +24,77 @@
 // Header files ///////////////////////////////////////////////////////////////
 
 #include <iostream>
-#include <cmath>
+#include <algorithm>
+#include <new>
+#include <functional>
+#include <thread>
+#include <type_traits>
 #include "BSTClass.h"
+#include "BSTNodePool.cpp"
+#include "FrozenBSTClass.cpp"
 
 using namespace std;
 
 static const char EMPTY_STR[4] = "---";
+static const char ELIDED_STR[4] = "...";
+
+// parallel walks split the tree into about this many pieces per worker,
+// subtrees this short are never split
+static const int PIECES_PER_THREAD = 8;
+static const int SEQUENTIAL_HEIGHT = 10;
+
+// batched finds advance this many searches in lock-step
+static const int BATCH_GROUP = 16;
+
+// set operations, and the other tree height above which they
+// work from a balanced copy of it
+static const int SET_UNION = 0;
+static const int SET_INTERSECTION = 1;
+static const int SET_DIFFERENCE = 2;
+static const int SET_RECURSION_HEIGHT = 128;
+
+// operations whose compares are counted with BST_STATS
+static const int STAT_FIND = 0;
+static const int STAT_INSERT = 1;
+static const int STAT_REMOVE = 2;
+
+/**
+ * @brief Ordering test for sorting
+ *
+ * @details Orders items by compareTo for standard algorithms
+ *
+ * @par Algorithm 
+ *      Tests compareTo result
+ * 
+ * @param [in] oneItem, otherItem
+ *             items to be compared
+ *
+ * @return Bool with true if oneItem sorts before otherItem
+ */
+template <class DataType>
+static bool lessByCompare( const DataType &oneItem, const DataType &otherItem )
+{
+    return oneItem.compareTo( otherItem ) < 0;
+}
+
+/**
+ * @brief Equality test for duplicate removal
+ *
+ * @details Matches items by compareTo for standard algorithms
+ *
+ * @par Algorithm 
+ *      Tests compareTo result
+ * 
+ * @param [in] oneItem, otherItem
+ *             items to be compared
+ *
+ * @return Bool with true if items are duplicates
+ */
+template <class DataType>
+static bool equalByCompare( const DataType &oneItem, const DataType &otherItem )
+{
+    return oneItem.compareTo( otherItem ) == 0;
+}
 
 /**
  * @brief Initialization BSTNode constructor
@@ -67,7 +132,10 @@ BSTNode<DataType>::BSTNode
    )
        : dataItem( nodeData ),
          left( leftPtr ),
-         right( rightPtr )
+         right( rightPtr ),
+         height( 1 ),
+         size( 1 ),
+         refCount( 1 )
 {
     // Initializers used
 }
@@ -82,7 +150,7 @@ BSTNode<DataType>::BSTNode
  * @post Empty BSTClass object is initialized
  *
  * @par Algorithm 
- *      Initializes rootNode to NULL
+ *      Initializes rootNode to NULL, selects PERSISTENT
  * 
  * @exception None
  *
@@ -90,18 +158,83 @@ BSTNode<DataType>::BSTNode
  *
  * @return None
  *
- * @note None
+ * @note Copies of a default tree share its nodes until either changes,
+ *       so a copy that is only read costs O(1)
  */
 template <class DataType>
 BSTClass<DataType>::BSTClass
    (
     // no parameters
    )
-       : rootNode( NULL )
+       : rootNode( NULL ),
+         options( PERSISTENT ),
+         nodePool( NULL ),
+         compareCount( 0 ),
+         sharedCompareCount( 0 ),
+         treeLock( NULL )
 {
     // Initializer used
 }
 
+/**
+ * @brief BSTClass option constructor
+ *
+ * @details Constructs BSTClass object with selected tree options
+ *          
+ * @pre assumes Uninitialized BSTClass object
+ *
+ * @post Empty BSTClass object is initialized with given options
+ *
+ * @par Algorithm 
+ *      Initializes rootNode to NULL and stores option flags
+ * 
+ * @exception None
+ *
+ * @param [in] treeOptions
+ *             Option flags, UNBALANCED or any of AVL_BALANCE, SLAB_ALLOC,
+ *             THREAD_SAFE, PERSISTENT, DEFERRED_FREE
+ *
+ * @return None
+ *
+ * @note With AVL_BALANCE the tree is rebalanced after every insert
+ *       and remove, keeping height O(log N) even for sorted input;
+ *       with SLAB_ALLOC nodes are carved from large blocks owned by
+ *       the tree, recycled on remove and freed per block on clear;
+ *       with THREAD_SAFE finds, traversals and other readers run in
+ *       parallel under a shared lock while each change takes the lock
+ *       exclusively; with PERSISTENT nodes are reference counted so
+ *       snapshots share them, and SLAB_ALLOC is ignored since a shared
+ *       node may outlive the tree that allocated it; with DEFERRED_FREE
+ *       clear and the destructor hand the nodes to a background thread
+ */
+template <class DataType>
+BSTClass<DataType>::BSTClass
+   (
+    int treeOptions     // input: tree option flags
+   )
+       : rootNode( NULL ),
+         options( treeOptions ),
+         nodePool( NULL ),
+         compareCount( 0 ),
+         sharedCompareCount( 0 ),
+         treeLock( NULL )
+{
+    if( options & PERSISTENT )
+    {
+        options &= ~SLAB_ALLOC;
+    }
+
+    if( options & SLAB_ALLOC )
+    {
+        nodePool = new BSTNodePool< BSTNode<DataType> >;
+    }
+
+    if( options & THREAD_SAFE )
+    {
+        treeLock = new BSTSharedMutex;
+    }
+}
+
 /**
  * @brief Copy BSTClass constructor
  *
@@ -112,25 +245,148 @@ BSTClass<DataType>::BSTClass
  * @post BSTClass object is initialized as copy
  *
  * @par Algorithm 
- *      Calls copyTree method
+ *      Calls adoptTree method
  * 
- * @exception None
+ * @exception bad_alloc if memory is exhausted
  *
  * @param [in] copied
  *             BSTClass object to be copied
  *
  * @return None
  *
- * @note None
+ * @note O(1) with PERSISTENT, nodes are copied only when first changed
  */
 template <class DataType>
 BSTClass<DataType>::BSTClass
    (
     const BSTClass<DataType> &copied     // input: object to be copied
    )
-       : rootNode( NULL )
+       : rootNode( NULL ),
+         options( copied.options ),
+         nodePool( NULL ),
+         compareCount( 0 ),
+         sharedCompareCount( 0 ),
+         treeLock( NULL )
+{
+    shared_lock<BSTSharedMutex> readGuard = copied.readLock();
+
+    if( options & SLAB_ALLOC )
+    {
+        nodePool = new BSTNodePool< BSTNode<DataType> >;
+    }
+
+    if( options & THREAD_SAFE )
+    {
+        treeLock = new BSTSharedMutex;
+    }
+
+    adoptTree( copied.rootNode );
+}
+
+/**
+ * @brief Parallel copy BSTClass constructor
+ *
+ * @details Constructs BSTClass as copy of input, using all workers
+ *          of pool
+ *          
+ * @pre assumes Uninitialized BSTClass object
+ *
+ * @post BSTClass object is initialized as copy
+ *
+ * @par Algorithm 
+ *      Shares nodes like the copy constructor with PERSISTENT,
+ *      otherwise calls parallelCopyTree method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] copied
+ *             BSTClass object to be copied
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Same result as the copy constructor, including node heights
+ */
+template <class DataType>
+BSTClass<DataType>::BSTClass
+   (
+    const BSTClass<DataType> &copied,     // input: object to be copied
+    BSTThreadPool &pool                   // input: workers to run on
+   )
+       : rootNode( NULL ),
+         options( copied.options ),
+         nodePool( NULL ),
+         compareCount( 0 ),
+         sharedCompareCount( 0 ),
+         treeLock( NULL )
+{
+    shared_lock<BSTSharedMutex> readGuard = copied.readLock();
+
+    if( options & SLAB_ALLOC )
+    {
+        nodePool = new BSTNodePool< BSTNode<DataType> >;
+    }
+
+    if( options & THREAD_SAFE )
+    {
+        treeLock = new BSTSharedMutex;
+    }
+
+    if( options & PERSISTENT )
+    {
+        adoptTree( copied.rootNode );
+    }
+
+    else
+    {
+        parallelCopyTree( copied.rootNode, pool );
+    }
+}
+
+/**
+ * @brief Move BSTClass constructor
+ *
+ * @details Constructs BSTClass by taking over the nodes of input
+ *          
+ * @pre assumes Uninitialized BSTClass object
+ *
+ * @post BSTClass object holds the tree, moved object is empty
+ *
+ * @par Algorithm 
+ *      Takes root, options, node pool and counters, leaving moved
+ *      object empty and using heap nodes
+ * 
+ * @exception None
+ *
+ * @param [in] moved
+ *             BSTClass object to take nodes from
+ *
+ * @return None
+ *
+ * @note O(1), no node is touched
+ */
+template <class DataType>
+BSTClass<DataType>::BSTClass
+   (
+    BSTClass<DataType> &&moved     // input: object to be moved
+   ) noexcept
+       : rootNode( moved.rootNode ),
+         options( moved.options ),
+         nodePool( moved.nodePool ),
+         compareCount( moved.compareCount ),
+         sharedCompareCount( moved.sharedCompareCount.load() ),
+         treeLock( moved.treeLock )
 {
-    copyTree( rootNode, copied.rootNode );
+    moved.rootNode = NULL;
+    moved.nodePool = NULL;
+    moved.options &= ~( SLAB_ALLOC | THREAD_SAFE );
+    moved.compareCount = 0;
+    moved.sharedCompareCount = 0;
+    moved.treeLock = NULL;
+
+    exchangeStats( moved );
 }
 
 /**
@@ -143,7 +399,8 @@ BSTClass<DataType>::BSTClass
  * @post BSTClass object is freed
  *
  * @par Algorithm 
- *      Calls clear method
+ *      Calls clearTree method, then frees node pool and lock
+ *      if they are used
  * 
  * @exception None
  *
@@ -159,7 +416,10 @@ BSTClass<DataType>::~BSTClass
     // no parameters
    )
 {
-    clear();
+    clearTree();
+
+    delete nodePool;
+    delete treeLock;
 }
 
 /**
@@ -172,16 +432,17 @@ BSTClass<DataType>::~BSTClass
  * @post BSTClass object is a copy
  *
  * @par Algorithm 
- *      Calls copyTree method after clearing
+ *      Calls adoptTree method after clearing
  * 
- * @exception None
+ * @exception bad_alloc if memory is exhausted
  *
  * @param [in] rhData
  *             BSTClass object to be copied
  *
  * @return None
  *
- * @note None
+ * @note O(1) with PERSISTENT; like the destructor, not synchronized
+ *       with other operations on this object even with THREAD_SAFE
  */
 template <class DataType>
 const BSTClass<DataType>& BSTClass<DataType>::operator =
@@ -192,12 +453,112 @@ const BSTClass<DataType>& BSTClass<DataType>::operator =
     if( this != &rhData )
     {
         clear();
-        copyTree( rootNode, rhData.rootNode );
+        options = rhData.options;
+
+        if( ( options & SLAB_ALLOC ) && nodePool == NULL )
+        {
+            nodePool = new BSTNodePool< BSTNode<DataType> >;
+        }
+
+        else if( ( options & SLAB_ALLOC ) == 0 )
+        {
+            delete nodePool;
+            nodePool = NULL;
+        }
+
+        if( ( options & THREAD_SAFE ) && treeLock == NULL )
+        {
+            treeLock = new BSTSharedMutex;
+        }
+
+        else if( ( options & THREAD_SAFE ) == 0 )
+        {
+            delete treeLock;
+            treeLock = NULL;
+        }
+
+        shared_lock<BSTSharedMutex> readGuard = rhData.readLock();
+
+        adoptTree( rhData.rootNode );
     }
 
     return *this;
 }
 
+/**
+ * @brief BSTClass move assignment operator
+ *
+ * @details Assigns BSTClass by taking over the nodes of input
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post BSTClass object holds the tree, rhData holds the old tree
+ *
+ * @par Algorithm 
+ *      Calls swap method, old contents are freed with rhData
+ * 
+ * @exception None
+ *
+ * @param [in] rhData
+ *             BSTClass object to take nodes from
+ *
+ * @return Reference to this BSTClass object
+ *
+ * @note O(1), no node is touched
+ */
+template <class DataType>
+const BSTClass<DataType>& BSTClass<DataType>::operator =
+   (
+    BSTClass<DataType> &&rhData     // input: object to be moved
+   ) noexcept
+{
+    swap( rhData );
+
+    return *this;
+}
+
+/**
+ * @brief Swap method
+ *
+ * @details Exchanges contents with another tree
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post Each object holds the other's tree, options and node pool
+ *
+ * @par Algorithm 
+ *      Swaps all data members
+ * 
+ * @exception None
+ *
+ * @param [in] other
+ *             BSTClass object to swap with
+ *
+ * @return None
+ *
+ * @note O(1), no node is touched; not synchronized even with
+ *       THREAD_SAFE, no other thread may use either object meanwhile
+ */
+template <class DataType>
+void BSTClass<DataType>::swap
+   (
+    BSTClass<DataType> &other     // input: object to swap with
+   ) noexcept
+{
+    std::swap( rootNode, other.rootNode );
+    std::swap( options, other.options );
+    std::swap( nodePool, other.nodePool );
+    std::swap( compareCount, other.compareCount );
+    std::swap( treeLock, other.treeLock );
+
+    sharedCompareCount = other.sharedCompareCount.exchange( 
+                                                sharedCompareCount.load() );
+
+    pathStack.swap( other.pathStack );
+
+    exchangeStats( other );
+}
+
 /**
  * @brief Clear method
  *
@@ -208,7 +569,7 @@ const BSTClass<DataType>& BSTClass<DataType>::operator =
  * @post BSTClass object is empty
  *
  * @par Algorithm 
- *      Calls clearHelper method
+ *      Calls clearTree method under write lock
  * 
  * @exception None
  *
@@ -224,8 +585,9 @@ void BSTClass<DataType>::clear
     // no parameters
    )
 {
-    clearHelper( rootNode );
-    rootNode = NULL;
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+
+    clearTree();
 }
 
 /**
@@ -255,7 +617,12 @@ void BSTClass<DataType>::insert
     const DataType &newData     // input: data to be inserted
    )
 {
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    long long startCount = compareCount;
+
     insertHelper( rootNode, newData );
+
+    recordCompares( STAT_INSERT, compareCount - startCount );
 }
 
 /**
@@ -285,770 +652,6590 @@ bool BSTClass<DataType>::find
     DataType &searchDataItem     // input: data to be searched for
    ) const
 {
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
     return findHelper( rootNode, searchDataItem );
 }
 
 /**
- * @brief Remove method
+ * @brief Find batch method
  *
- * @details Removes data from object
+ * @details Finds each of an array of items in object
  *          
  * @pre assumes Initialized BSTClass object
  *
- * @post Data is removed from BST
+ * @post Know which items exist in BST
  *
  * @par Algorithm 
- *      Calls removeHelper method
+ *      Takes the items BATCH_GROUP at a time and moves every search of
+ *      the group down one level per round, comparing once and
+ *      prefetching the child it goes to, so the cache misses of one
+ *      search overlap the compares of the others
  * 
  * @exception None
  *
- * @param [in] dataItem
- *             Data to be removed
+ * @param [in] searchItems
+ *             Data to be searched for
  *
- * @return Bool with true for success
+ * @param [out] foundFlags
+ *              one result per item, true if found
  *
- * @note None
+ * @param [in] itemCount
+ *              number of items
+ *
+ * @return Number of items found
+ *
+ * @note Same compares as itemCount finds; pays off once the tree
+ *       is well beyond cache
  */
 template <class DataType>
-bool BSTClass<DataType>::remove
+int BSTClass<DataType>::findBatch
    (
-    const DataType &dataItem     // input: data to be removed
-   )
+    const DataType *searchItems,     // input: data to be searched for
+    bool *foundFlags,                // output: result per item
+    int itemCount                    // input: number of items
+   ) const
 {
-    if( !isEmpty() )
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    const BSTNode<DataType> *cursors[ BATCH_GROUP ];
+    int first, groupSize, index, activeCount, difference, round;
+    int foundCount = 0;
+    long long compares = 0;
+
+    for( first = 0; first < itemCount; first += BATCH_GROUP )
     {
-        return removeHelper(rootNode, dataItem);
+        groupSize = min( BATCH_GROUP, itemCount - first );
+
+        for( index = 0; index < groupSize; index++ )
+        {
+            cursors[ index ] = rootNode;
+            foundFlags[ first + index ] = false;
+
+            if( rootNode == NULL )
+            {
+                recordCompares( STAT_FIND, 0 );
+            }
+        }
+
+        activeCount = rootNode == NULL ? 0 : groupSize;
+
+        for( round = 1; activeCount > 0; round++ )
+        {
+            activeCount = 0;
+
+            for( index = 0; index < groupSize; index++ )
+            {
+                if( cursors[ index ] == NULL )
+                {
+                    continue;
+                }
+
+                difference = searchItems[ first + index ].compareTo( 
+                                                 cursors[ index ]->dataItem );
+                compares++;
+
+                if( difference == 0 )
+                {
+                    foundFlags[ first + index ] = true;
+                    foundCount++;
+
+                    cursors[ index ] = NULL;
+
+                    recordCompares( STAT_FIND, round );
+                }
+
+                else
+                {
+                    if( difference < 0 )
+                    {
+                        cursors[ index ] = cursors[ index ]->left;
+                    }
+
+                    else
+                    {
+                        cursors[ index ] = cursors[ index ]->right;
+                    }
+
+                    // data and links may sit on different cache lines
+                    if( cursors[ index ] != NULL )
+                    {
+                        __builtin_prefetch( cursors[ index ] );
+                        __builtin_prefetch( &cursors[ index ]->right );
+
+                        activeCount++;
+                    }
+
+                    else
+                    {
+                        recordCompares( STAT_FIND, round );
+                    }
+                }
+            }
+        }
     }
 
-    return false;
+    countCompares( compares );
+
+    return foundCount;
 }
 
 /**
- * @brief isEmpty method
+ * @brief Size method
  *
- * @details Checks if object is empty
+ * @details Gives the number of items in object
  *          
  * @pre assumes Initialized BSTClass object
  *
- * @post Know if BST is empty
+ * @post None
  *
  * @par Algorithm 
- *      Checks if rootNode is NULL
+ *      Reads subtree size of the root
  * 
  * @exception None
  *
  * @param None
  *
- * @return Bool with true if empty
+ * @return Number of items as int
  *
- * @note None
+ * @note O(1)
  */
 template <class DataType>
-bool BSTClass<DataType>::isEmpty
+int BSTClass<DataType>::size
    (
     // no parameters
    ) const
 {
-    return ( rootNode == NULL );
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    return nodeSize( rootNode );
 }
 
 /**
- * @brief Preorder Traversal
+ * @brief Height method
  *
- * @details Outputs list in pre-order
+ * @details Gives the number of levels in object
  *          
  * @pre assumes Initialized BSTClass object
  *
- * @post Data in BST has been output to screen
+ * @post None
  *
  * @par Algorithm 
- *      Calls preOrderTraversalHelper method
+ *      Reads cached height of the root
  * 
  * @exception None
  *
  * @param None
  *
- * @return None
+ * @return Height as int, 0 for an empty tree
  *
- * @note None
+ * @note O(1); every change keeps the heights on its path current
  */
 template <class DataType>
-void BSTClass<DataType>::preOrderTraversal
+int BSTClass<DataType>::height
    (
     // no parameters
    ) const
 {
-    if( isEmpty() )
-    {
-        cout << "Tree is empty" << endl;
-    }
+    shared_lock<BSTSharedMutex> readGuard = readLock();
 
-    else
-    {
-        preOrderTraversalHelper( rootNode );
-        cout << endl;   
-    }
+    return nodeHeight( rootNode );
 }
 
 /**
- * @brief Inorder Traversal
+ * @brief Rank method
  *
- * @details Outputs list in order
+ * @details Counts items sorting before given data
  *          
  * @pre assumes Initialized BSTClass object
  *
- * @post Data in BST has been output to screen
+ * @post None
  *
  * @par Algorithm 
- *      Calls inOrderTraversalHelper method
+ *      Walks down as find does, comparing once per node; each time
+ *      the walk goes right, or stops on a match, the left subtree
+ *      size is added, plus one for a node passed on the right
  * 
  * @exception None
  *
- * @param None
+ * @param [in] rankDataItem
+ *             Data to be ranked, need not be in the tree
  *
- * @return None
+ * @return Number of items less than rankDataItem, from 0 to size()
  *
- * @note None
+ * @note O(log N) with AVL_BALANCE; select( rank( item ) ) finds item
+ *       when it is present
+ */
+template <class DataType>
+int BSTClass<DataType>::rank
+   (
+    const DataType &rankDataItem     // input: data to be ranked
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    const BSTNode<DataType> *workingPtr = rootNode;
+    int difference, lessCount = 0;
+    long long compares = 0;
+
+    while( workingPtr != NULL )
+    {
+        difference = rankDataItem.compareTo( workingPtr->dataItem );
+        compares++;
+
+        if( difference < 0 )
+        {
+            workingPtr = workingPtr->left;
+        }
+
+        else if( difference > 0 )
+        {
+            lessCount += nodeSize( workingPtr->left ) + 1;
+
+            workingPtr = workingPtr->right;
+        }
+
+        else
+        {
+            lessCount += nodeSize( workingPtr->left );
+
+            workingPtr = NULL;
+        }
+    }
+
+    countCompares( compares );
+
+    return lessCount;
+}
+
+/**
+ * @brief Select method
+ *
+ * @details Finds the item at a given position in sorted order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Item at position has been returned, if in range
+ *
+ * @par Algorithm 
+ *      Walks down comparing the position with the left subtree size,
+ *      going right past the left subtree and the node when it is
+ *      larger, without comparing any items
+ * 
+ * @exception None
+ *
+ * @param [in] position
+ *             position from 0, the smallest item, to size() - 1
+ *
+ * @param [out] foundItem
+ *              Item at position
+ *
+ * @return Bool with true if position was in range
+ *
+ * @note O(log N) with AVL_BALANCE
+ */
+template <class DataType>
+bool BSTClass<DataType>::select
+   (
+    int position,             // input: position in sorted order
+    DataType &foundItem       // output: item at position
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    const BSTNode<DataType> *workingPtr = rootNode;
+    int leftSize;
+
+    if( position < 0 || position >= nodeSize( rootNode ) )
+    {
+        return false;
+    }
+
+    while( true )
+    {
+        leftSize = nodeSize( workingPtr->left );
+
+        if( position < leftSize )
+        {
+            workingPtr = workingPtr->left;
+        }
+
+        else if( position > leftSize )
+        {
+            position -= leftSize + 1;
+
+            workingPtr = workingPtr->right;
+        }
+
+        else
+        {
+            foundItem = workingPtr->dataItem;
+
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Remove method
+ *
+ * @details Removes data from object
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data is removed from BST
+ *
+ * @par Algorithm 
+ *      Calls removeHelper method
+ * 
+ * @exception None
+ *
+ * @param [in] dataItem
+ *             Data to be removed
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTClass<DataType>::remove
+   (
+    const DataType &dataItem     // input: data to be removed
+   )
+{
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    long long startCount = compareCount;
+    bool removed = false;
+
+    if( rootNode != NULL )
+    {
+        removed = removeHelper(rootNode, dataItem);
+    }
+
+    recordCompares( STAT_REMOVE, compareCount - startCount );
+
+    return removed;
+}
+
+/**
+ * @brief Build from sorted method
+ *
+ * @details Replaces contents with a perfectly balanced tree of items
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Tree holds each distinct item once, every subtree is balanced
+ *
+ * @par Algorithm 
+ *      One linear pass checks the items are strictly ascending; if not
+ *      (out of order or duplicates) they are stable sorted and the later
+ *      of equal items dropped, matching insert; then buildHelper links
+ *      the middle item of each range as subtree root
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] items
+ *             array of items, ideally in ascending order
+ *
+ * @param [in] itemCount
+ *             number of items in array
+ *
+ * @return None
+ *
+ * @note O(N) for sorted input, O(N log N) for the fallback
+ */
+template <class DataType>
+void BSTClass<DataType>::buildFromSorted
+   (
+    const DataType *items,     // input: items to build from
+    int itemCount              // input: number of items
+   )
+{
+    vector<DataType> sortedItems;
+    unique_lock<BSTSharedMutex> writeGuard;
+    int index = 1;
+
+    while( index < itemCount 
+                       && items[ index ].compareTo( items[ index - 1 ] ) > 0 )
+    {
+        index++;
+    }
+
+    if( index < itemCount )
+    {
+        sortedItems.assign( items, items + itemCount );
+
+        stable_sort( sortedItems.begin(), sortedItems.end(), 
+                                                 lessByCompare<DataType> );
+
+        sortedItems.erase( unique( sortedItems.begin(), sortedItems.end(),
+                            equalByCompare<DataType> ), sortedItems.end() );
+
+        items = &sortedItems[ 0 ];
+        itemCount = int( sortedItems.size() );
+    }
+
+    writeGuard = writeLock();
+
+    clearTree();
+
+    if( nodePool != NULL )
+    {
+        nodePool->reserve( itemCount );
+    }
+
+    rootNode = buildHelper( items, 0, itemCount - 1 );
+}
+
+/**
+ * @brief Build from unsorted method
+ *
+ * @details Replaces contents with a perfectly balanced tree of items,
+ *          using several threads
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Tree holds each distinct item once, every subtree is balanced
+ *
+ * @par Algorithm 
+ *      Copies items, stable sorts one chunk per thread, merges chunk
+ *      pairs in parallel rounds, drops the later of equal items to
+ *      match insert, then calls parallelBuildHelper
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] items
+ *             array of items in any order
+ *
+ * @param [in] itemCount
+ *             number of items in array
+ *
+ * @param [in] numThreads
+ *             number of threads to use, at least 1
+ *
+ * @return None
+ *
+ * @note With SLAB_ALLOC all nodes are taken as one run of the pool,
+ *       so the threads never touch the pool itself
+ */
+template <class DataType>
+void BSTClass<DataType>::buildFromUnsorted
+   (
+    const DataType *items,     // input: items to build from
+    int itemCount,             // input: number of items
+    int numThreads             // input: threads to use
+   )
+{
+    vector<DataType> sortedItems( items, items + itemCount );
+    vector<thread> workers;
+    vector<int> chunkStart;
+    BSTNode<DataType> *nodeRun = NULL;
+    unique_lock<BSTSharedMutex> writeGuard;
+    typename vector<DataType>::iterator first = sortedItems.begin();
+    int index, chunkCount, width;
+
+    if( itemCount == 0 )
+    {
+        clear();
+
+        return;
+    }
+
+    if( numThreads < 1 )
+    {
+        numThreads = 1;
+    }
+
+    chunkCount = numThreads;
+
+    if( chunkCount > itemCount )
+    {
+        chunkCount = itemCount;
+    }
+
+    for( index = 0; index <= chunkCount; index++ )
+    {
+        chunkStart.push_back( int( ( long long )itemCount * index 
+                                                           / chunkCount ) );
+    }
+
+    for( index = 0; index < chunkCount; index++ )
+    {
+        workers.push_back( thread( stable_sort<
+                            typename vector<DataType>::iterator,
+                            bool (*)( const DataType &, const DataType & ) >,
+                            first + chunkStart[ index ],
+                            first + chunkStart[ index + 1 ],
+                            lessByCompare<DataType> ) );
+    }
+
+    for( index = 0; index < chunkCount; index++ )
+    {
+        workers[ index ].join();
+    }
+
+    // each round merges neighbouring runs, doubling the run width
+    for( width = 1; width < chunkCount; width *= 2 )
+    {
+        workers.clear();
+
+        for( index = 0; index + width < chunkCount; index += 2 * width )
+        {
+            workers.push_back( thread( inplace_merge<
+                   typename vector<DataType>::iterator,
+                   bool (*)( const DataType &, const DataType & ) >,
+                   first + chunkStart[ index ],
+                   first + chunkStart[ index + width ],
+                   first + chunkStart[ min( index + 2 * width, chunkCount ) ],
+                   lessByCompare<DataType> ) );
+        }
+
+        for( index = 0; index < int( workers.size() ); index++ )
+        {
+            workers[ index ].join();
+        }
+    }
+
+    sortedItems.erase( unique( sortedItems.begin(), sortedItems.end(),
+                            equalByCompare<DataType> ), sortedItems.end() );
+
+    itemCount = int( sortedItems.size() );
+
+    writeGuard = writeLock();
+
+    clearTree();
+
+    if( nodePool != NULL )
+    {
+        nodeRun = nodePool->allocateRun( itemCount );
+    }
+
+    parallelBuildHelper( rootNode, &sortedItems[ 0 ], 0, itemCount - 1,
+                                                       numThreads, nodeRun );
+
+    countNodes( itemCount, 0 );
+}
+
+/**
+ * @brief Build from stream method
+ *
+ * @details Replaces contents with a balanced tree of items read
+ *          from a stream
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Tree holds each distinct item read
+ *
+ * @par Algorithm 
+ *      Reads items with readItem until it fails,
+ *      then calls buildFromSorted method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] inStream
+ *             stream to read from
+ *
+ * @param [in] readItem
+ *             function reading one item, false at end of data
+ *
+ * @return None
+ *
+ * @note Works with PA07 getALine
+ */
+template <class DataType>
+void BSTClass<DataType>::buildFromStream
+   (
+    istream &inStream,                               // input: data source
+    bool ( *readItem )( istream &, DataType & )      // input: item reader
+   )
+{
+    vector<DataType> readItems;
+    DataType inputData;
+
+    while( readItem( inStream, inputData ) )
+    {
+        readItems.push_back( inputData );
+    }
+
+    if( readItems.empty() )
+    {
+        clear();
+    }
+
+    else
+    {
+        buildFromSorted( &readItems[ 0 ], int( readItems.size() ) );
+    }
+}
+
+/**
+ * @brief Split method
+ *
+ * @details Moves the items at and above a given item to a new tree
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post This tree holds the items below splitItem, returned tree
+ *       holds the rest
+ *
+ * @par Algorithm 
+ *      Calls splitHelper method, which cuts the search path for
+ *      splitItem and joins the pieces hanging off each side of it,
+ *      then hands the upper root to a tree with the same options
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] splitItem
+ *             first item to go to the returned tree
+ *
+ * @return Tree of items not below splitItem
+ *
+ * @note O(log N) with AVL_BALANCE, nodes are moved, not copied;
+ *       with SLAB_ALLOC the returned items are copied into the new
+ *       tree's pool, since a pool is owned by exactly one tree
+ */
+template <class DataType>
+BSTClass<DataType> BSTClass<DataType>::split
+   (
+    const DataType &splitItem     // input: first item of upper tree
+   )
+{
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    BSTClass<DataType> highTree( options );
+    BSTNode<DataType> *highPtr, *foundPtr;
+
+    foundPtr = splitHelper( rootNode, splitItem, rootNode, highPtr, 
+                                                            compareCount );
+
+    if( foundPtr != NULL )
+    {
+        highPtr = joinHelper( NULL, foundPtr, highPtr );
+    }
+
+    if( nodePool != NULL )
+    {
+        highTree.copyTree( highTree.rootNode, highPtr, highTree.nodePool );
+
+        clearHelper( highPtr );
+    }
+
+    else
+    {
+        highTree.rootNode = highPtr;
+    }
+
+    return highTree;
+}
+
+/**
+ * @brief Join method
+ *
+ * @details Appends the items of a tree whose items all follow
+ *          the items of this one
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post Unless false is returned, this tree holds the items of both
+ *       trees and highTree is empty
+ *
+ * @par Algorithm 
+ *      Compares the last item here with the first one of highTree,
+ *      takes the nodes of highTree with takeTree method, then calls
+ *      joinTrees method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] highTree
+ *             tree of items to be appended
+ *
+ * @return Bool with true for success, false if the item ranges
+ *         overlap and nothing was changed
+ *
+ * @note O(log N) with AVL_BALANCE when both trees use the same
+ *       options, nodes are moved; not synchronized for highTree even
+ *       with THREAD_SAFE, as with swap
+ */
+template <class DataType>
+bool BSTClass<DataType>::join
+   (
+    BSTClass<DataType> &highTree     // input: tree of following items
+   )
+{
+    const BSTNode<DataType> *lastPtr, *firstPtr;
+
+    if( this == &highTree )
+    {
+        return isEmpty();
+    }
+
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+
+    lastPtr = rootNode;
+    firstPtr = highTree.rootNode;
+
+    if( lastPtr != NULL && firstPtr != NULL )
+    {
+        while( lastPtr->right != NULL )
+        {
+            lastPtr = lastPtr->right;
+        }
+
+        while( firstPtr->left != NULL )
+        {
+            firstPtr = firstPtr->left;
+        }
+
+        compareCount++;
+
+        if( lastPtr->dataItem.compareTo( firstPtr->dataItem ) >= 0 )
+        {
+            return false;
+        }
+    }
+
+    rootNode = joinTrees( rootNode, takeTree( highTree ) );
+
+    return true;
+}
+
+/**
+ * @brief Merge method
+ *
+ * @details Moves all items of another tree into this one
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the items of both trees, other is empty
+ *
+ * @par Algorithm 
+ *      Lists the nodes of each tree in order with flattenTree method,
+ *      merges the two lists, freeing the other tree's node for an item
+ *      held by both, then relinks the merged list as a balanced tree
+ *      with relinkHelper method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree whose items are to be moved
+ *
+ * @return None
+ *
+ * @note O(N + M), and no node is allocated when both trees keep
+ *       nodes the same way; a node still shared with a snapshot is
+ *       copied instead of moved; not synchronized for other even with
+ *       THREAD_SAFE, as with swap
+ */
+template <class DataType>
+void BSTClass<DataType>::merge
+   (
+    BSTClass<DataType> &other     // input: tree to be emptied
+   )
+{
+    vector<BSTNode<DataType> *> ownList, otherList, mergedList, sharedList;
+    size_t ownIndex = 0, otherIndex = 0;
+    int difference;
+    bool reuseNodes = ( nodePool == NULL ) == ( other.nodePool == NULL );
+
+    if( this == &other )
+    {
+        return;
+    }
+
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+
+    if( other.rootNode == NULL )
+    {
+        return;
+    }
+
+    flattenTree( rootNode, true, ownList, sharedList );
+    flattenTree( other.rootNode, reuseNodes, otherList, sharedList );
+
+    if( !reuseNodes )
+    {
+        other.clearTree();
+    }
+
+    else if( nodePool != NULL )
+    {
+        nodePool->absorb( *other.nodePool );
+    }
+
+    other.rootNode = NULL;
+
+    mergedList.reserve( ownList.size() + otherList.size() );
+
+    while( ownIndex < ownList.size() && otherIndex < otherList.size() )
+    {
+        difference = ownList[ ownIndex ]->dataItem.compareTo( 
+                                         otherList[ otherIndex ]->dataItem );
+        compareCount++;
+
+        if( difference < 0 )
+        {
+            mergedList.push_back( ownList[ ownIndex++ ] );
+        }
+
+        else if( difference > 0 )
+        {
+            mergedList.push_back( otherList[ otherIndex++ ] );
+        }
+
+        else
+        {
+            mergedList.push_back( ownList[ ownIndex++ ] );
+
+            freeNode( otherList[ otherIndex++ ] );
+        }
+    }
+
+    mergedList.insert( mergedList.end(), ownList.begin() + ownIndex, 
+                                                            ownList.end() );
+    mergedList.insert( mergedList.end(), otherList.begin() + otherIndex, 
+                                                          otherList.end() );
+
+    for( ownIndex = 0; ownIndex < sharedList.size(); ownIndex++ )
+    {
+        releaseNode( sharedList[ ownIndex ] );
+    }
+
+    rootNode = relinkHelper( &mergedList[ 0 ], 0, 
+                                              int( mergedList.size() ) - 1 );
+}
+
+/**
+ * @brief Union method
+ *
+ * @details Adds the items of another tree to this one
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the items of both trees, other is unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be added
+ *
+ * @return None
+ *
+ * @note O(M log( N / M + 1 )) with AVL_BALANCE, for trees of
+ *       N and M items, M the smaller
+ */
+template <class DataType>
+void BSTClass<DataType>::unionWith
+   (
+    const BSTClass<DataType> &other     // input: tree of items to add
+   )
+{
+    setOperation( other, SET_UNION, NULL );
+}
+
+/**
+ * @brief Parallel union method
+ *
+ * @details Adds the items of another tree to this one, using all
+ *          workers of pool
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the items of both trees, other is unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method with pool
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be added
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Same result as unionWith on one thread
+ */
+template <class DataType>
+void BSTClass<DataType>::unionWith
+   (
+    const BSTClass<DataType> &other,     // input: tree of items to add
+    BSTThreadPool &pool                  // input: workers to run on
+   )
+{
+    setOperation( other, SET_UNION, &pool );
+}
+
+/**
+ * @brief Intersection method
+ *
+ * @details Removes the items missing from another tree
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the items found in both trees, other is
+ *       unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be kept
+ *
+ * @return None
+ *
+ * @note O(M log( N / M + 1 )) with AVL_BALANCE, as for unionWith
+ */
+template <class DataType>
+void BSTClass<DataType>::intersectWith
+   (
+    const BSTClass<DataType> &other     // input: tree of items to keep
+   )
+{
+    setOperation( other, SET_INTERSECTION, NULL );
+}
+
+/**
+ * @brief Parallel intersection method
+ *
+ * @details Removes the items missing from another tree, using all
+ *          workers of pool
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the items found in both trees, other is
+ *       unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method with pool
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be kept
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Same result as intersectWith on one thread
+ */
+template <class DataType>
+void BSTClass<DataType>::intersectWith
+   (
+    const BSTClass<DataType> &other,     // input: tree of items to keep
+    BSTThreadPool &pool                  // input: workers to run on
+   )
+{
+    setOperation( other, SET_INTERSECTION, &pool );
+}
+
+/**
+ * @brief Difference method
+ *
+ * @details Removes the items of another tree from this one
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds its items not found in other, other is
+ *       unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be removed
+ *
+ * @return None
+ *
+ * @note O(M log( N / M + 1 )) with AVL_BALANCE, as for unionWith
+ */
+template <class DataType>
+void BSTClass<DataType>::differenceWith
+   (
+    const BSTClass<DataType> &other     // input: tree of items to remove
+   )
+{
+    setOperation( other, SET_DIFFERENCE, NULL );
+}
+
+/**
+ * @brief Parallel difference method
+ *
+ * @details Removes the items of another tree from this one, using all
+ *          workers of pool
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds its items not found in other, other is
+ *       unchanged
+ *
+ * @par Algorithm 
+ *      Calls setOperation method with pool
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree of items to be removed
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Same result as differenceWith on one thread
+ */
+template <class DataType>
+void BSTClass<DataType>::differenceWith
+   (
+    const BSTClass<DataType> &other,     // input: tree of items to remove
+    BSTThreadPool &pool                  // input: workers to run on
+   )
+{
+    setOperation( other, SET_DIFFERENCE, &pool );
+}
+
+/**
+ * @brief isEmpty method
+ *
+ * @details Checks if object is empty
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Know if BST is empty
+ *
+ * @par Algorithm 
+ *      Checks if rootNode is NULL
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if empty
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTClass<DataType>::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    return ( rootNode == NULL );
+}
+
+/**
+ * @brief Preorder Traversal
+ *
+ * @details Outputs list in pre-order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to screen
+ *
+ * @par Algorithm 
+ *      Calls preOrderTraversal method with cout
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::preOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    preOrderTraversal( cout );
+}
+
+/**
+ * @brief Preorder Traversal to stream
+ *
+ * @details Outputs list in pre-order to given stream
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to stream, stream is flushed once
+ *
+ * @par Algorithm 
+ *      Calls traversalHelper method with pre-order iterators
+ * 
+ * @exception None
+ *
+ * @param [in] outStream
+ *             stream to receive one line per item
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::preOrderTraversal
+   (
+    ostream &outStream     // input: stream to write to
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    if( rootNode == NULL )
+    {
+        outStream << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        traversalHelper( outStream, preOrderBegin(), preOrderEnd() );
+    }
+}
+
+/**
+ * @brief Inorder Traversal
+ *
+ * @details Outputs list in order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to screen
+ *
+ * @par Algorithm 
+ *      Calls inOrderTraversal method with cout
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::inOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    inOrderTraversal( cout );
+}
+
+/**
+ * @brief Inorder Traversal to stream
+ *
+ * @details Outputs list in order to given stream
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to stream, stream is flushed once
+ *
+ * @par Algorithm 
+ *      Calls traversalHelper method with in-order iterators
+ * 
+ * @exception None
+ *
+ * @param [in] outStream
+ *             stream to receive one line per item
+ *
+ * @return None
+ *
+ * @note None
  */
 template <class DataType>
 void BSTClass<DataType>::inOrderTraversal
+   (
+    ostream &outStream     // input: stream to write to
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    if( rootNode == NULL )
+    {
+        outStream << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        traversalHelper( outStream, begin(), end() );
+    }
+}
+
+/**
+ * @brief Postorder Traversal
+ *
+ * @details Outputs list in post-order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to screen
+ *
+ * @par Algorithm 
+ *      Calls postOrderTraversal method with cout
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::postOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    postOrderTraversal( cout );
+}
+
+/**
+ * @brief Postorder Traversal to stream
+ *
+ * @details Outputs list in post-order to given stream
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to stream, stream is flushed once
+ *
+ * @par Algorithm 
+ *      Calls traversalHelper method with post-order iterators
+ * 
+ * @exception None
+ *
+ * @param [in] outStream
+ *             stream to receive one line per item
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::postOrderTraversal
+   (
+    ostream &outStream     // input: stream to write to
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    if( rootNode == NULL )
+    {
+        outStream << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        traversalHelper( outStream, postOrderBegin(), postOrderEnd() );
+    }
+}
+
+/**
+ * @brief Write lock method
+ *
+ * @details Takes exclusive access to the tree
+ *          
+ * @pre assumes calling thread holds no lock on this tree
+ *
+ * @post No other thread reads or changes the tree until the
+ *       returned guard is released
+ *
+ * @par Algorithm 
+ *      Locks tree lock exclusively if THREAD_SAFE is set,
+ *      otherwise returns a guard holding nothing
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Guard releasing the lock when it goes out of scope
+ *
+ * @note None
+ */
+template <class DataType>
+unique_lock<BSTSharedMutex> BSTClass<DataType>::writeLock
+   (
+    // no parameters
+   ) const
+{
+    if( treeLock != NULL )
+    {
+        return unique_lock<BSTSharedMutex>( *treeLock );
+    }
+
+    return unique_lock<BSTSharedMutex>();
+}
+
+/**
+ * @brief Read lock method
+ *
+ * @details Takes shared access to the tree
+ *          
+ * @pre assumes calling thread holds no lock on this tree
+ *
+ * @post No other thread changes the tree until the returned
+ *       guard is released, other readers may proceed
+ *
+ * @par Algorithm 
+ *      Locks tree lock shared if THREAD_SAFE is set,
+ *      otherwise returns a guard holding nothing
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Guard releasing the lock when it goes out of scope
+ *
+ * @note None
+ */
+template <class DataType>
+shared_lock<BSTSharedMutex> BSTClass<DataType>::readLock
+   (
+    // no parameters
+   ) const
+{
+    if( treeLock != NULL )
+    {
+        return shared_lock<BSTSharedMutex>( *treeLock );
+    }
+
+    return shared_lock<BSTSharedMutex>();
+}
+
+/**
+ * @brief Clear tree method
+ *
+ * @details Frees all nodes
+ *          
+ * @pre assumes caller holds the write lock, if any
+ *
+ * @post BSTClass object is empty
+ *
+ * @par Algorithm 
+ *      Releases whole pool blocks when nodes need no destruction;
+ *      otherwise with DEFERRED_FREE calls deferTree method, and if the
+ *      reclaimer refuses, or without it, drops the reference to the
+ *      root when PERSISTENT is set or calls clearHelper method
+ * 
+ * @exception bad_alloc if memory is exhausted, only with DEFERRED_FREE
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note With DEFERRED_FREE may wait for the reclaimer to free
+ *       earlier trees, see BSTReclaimer::defer
+ */
+template <class DataType>
+void BSTClass<DataType>::clearTree
+   (
+    // no parameters
+   )
+{
+    if( nodePool != NULL && is_trivially_destructible<DataType>::value )
+    {
+        countNodes( 0, nodeSize( rootNode ) );
+
+        nodePool->releaseAll();
+    }
+
+    else if( ( options & DEFERRED_FREE ) && deferTree() )
+    {
+        // Reclaimer owns the nodes now
+    }
+
+    else if( options & PERSISTENT )
+    {
+        releaseNode( rootNode );
+    }
+
+    else
+    {
+        clearHelper( rootNode );
+    }
+
+    rootNode = NULL;
+}
+
+/**
+ * @brief Defer tree method
+ *
+ * @details Hands all nodes to the shared reclaimer
+ *          
+ * @pre assumes caller holds the write lock, if any
+ *
+ * @post Unless false is returned, nodes are freed on the reclaiming
+ *       thread and the tree may take new nodes at once
+ *
+ * @par Algorithm 
+ *      Packs the root, and the node pool when SLAB_ALLOC is set, into
+ *      a graph that reclaimStep frees, and defers it sized at the
+ *      root's subtree size; a slab tree then starts on a new pool
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return Bool with true if the reclaimer took the nodes, false if
+ *         caller must free them
+ *
+ * @note O(1) on this thread; with PERSISTENT the size counts shared
+ *       nodes too, so the bound is never exceeded, but for BST_STATS
+ *       reclaimStep counts only the nodes it actually frees
+ */
+template <class DataType>
+bool BSTClass<DataType>::deferTree
+   (
+    // no parameters
+   )
+{
+    ReclaimGraph *graph;
+    BSTNodePool< BSTNode<DataType> > *freshPool = NULL;
+    int graphNodes;
+
+    if( rootNode == NULL )
+    {
+        return false;
+    }
+
+    graphNodes = nodeSize( rootNode );
+
+    if( nodePool != NULL )
+    {
+        freshPool = new BSTNodePool< BSTNode<DataType> >;
+    }
+
+    graph = new ReclaimGraph;
+
+    graph->nodeStack.push_back( rootNode );
+    graph->graphPool = nodePool;
+    graph->shared = ( options & PERSISTENT ) != 0;
+
+#ifdef BST_STATS
+    if( graph->shared )
+    {
+        graph->freedCount = statCounters.deferredFreed;
+    }
+#endif
+
+    if( !BSTReclaimer::getShared().defer( 
+                    bind( &BSTClass<DataType>::reclaimStep, graph, 
+                                                            placeholders::_1 ),
+                    graphNodes * sizeof( BSTNode<DataType> ),
+                    sizeof( BSTNode<DataType> ) ) )
+    {
+        delete graph;
+        delete freshPool;
+
+        return false;
+    }
+
+    nodePool = freshPool;
+
+    // graph may already be freed, so options decide
+    if( !( options & PERSISTENT ) )
+    {
+        countNodes( 0, graphNodes );
+    }
+
+    return true;
+}
+
+/**
+ * @brief Reclaim step method
+ *
+ * @details Frees part of a deferred graph, run by the reclaimer
+ *          
+ * @pre assumes graph was made by deferTree and no tree can reach it
+ *
+ * @post Up to nodeBudget nodes are visited; once the last is,
+ *       graph and its pool are freed
+ *
+ * @par Algorithm 
+ *      Pops nodes off the explicit stack; with shared nodes one that
+ *      another tree still references is only released, otherwise the
+ *      children are pushed and the node destroyed, in place when it
+ *      lives in the graph's pool; destroyed shared nodes are added to
+ *      the graph's freed count, if it has one
+ * 
+ * @exception None
+ *
+ * @param [in] graph
+ *             graph to be freed
+ *
+ * @param [in] nodeBudget
+ *             most nodes to visit in this step
+ *
+ * @return Bool with true once the whole graph is freed
+ *
+ * @note Static, the tree that deferred the graph may already be gone
+ */
+template <class DataType>
+bool BSTClass<DataType>::reclaimStep
+   (
+    ReclaimGraph *graph,     // input: graph to be freed
+    int nodeBudget           // input: most nodes to visit
+   )
+{
+    BSTNode<DataType> *workingPtr;
+    int visited, freedNodes = 0;
+
+    for( visited = 0; visited < nodeBudget && !graph->nodeStack.empty();
+                                                                  visited++ )
+    {
+        workingPtr = graph->nodeStack.back();
+        graph->nodeStack.pop_back();
+
+        if( graph->shared 
+          && workingPtr->refCount.fetch_sub( 1, memory_order_acq_rel ) != 1 )
+        {
+            continue;
+        }
+
+        if( workingPtr->left != NULL )
+        {
+            graph->nodeStack.push_back( workingPtr->left );
+        }
+
+        if( workingPtr->right != NULL )
+        {
+            graph->nodeStack.push_back( workingPtr->right );
+        }
+
+        freedNodes++;
+
+        if( graph->graphPool != NULL )
+        {
+            workingPtr->~BSTNode<DataType>();
+        }
+
+        else
+        {
+            delete workingPtr;
+        }
+    }
+
+    if( graph->freedCount != NULL )
+    {
+        graph->freedCount->fetch_add( freedNodes, memory_order_relaxed );
+    }
+
+    if( graph->nodeStack.empty() )
+    {
+        delete graph->graphPool;
+        delete graph;
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Allocate node method
+ *
+ * @details Creates a node holding given data from a given pool
+ *          
+ * @pre assumes no other thread is using fromPool
+ *
+ * @post New leaf node exists
+ *
+ * @par Algorithm 
+ *      Constructs node in a slot of fromPool if given,
+ *      otherwise on the heap
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] nodeData
+ *             Data to be stored in node
+ *
+ * @param [in] fromPool
+ *             pool to take slot from, or NULL
+ *
+ * @return Pointer to new node
+ *
+ * @note None
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::allocateNode
+   (
+    const DataType &nodeData,                       // input: data to store
+    BSTNodePool< BSTNode<DataType> > *fromPool      // input: pool or NULL
+   )
+{
+    if( fromPool != NULL )
+    {
+        return new ( fromPool->allocate() ) 
+                                  BSTNode<DataType>( nodeData, NULL, NULL );
+    }
+
+    return new BSTNode<DataType>( nodeData, NULL, NULL );
+}
+
+/**
+ * @brief New node method
+ *
+ * @details Creates a node holding given data
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post New leaf node exists, owned by this tree
+ *
+ * @par Algorithm 
+ *      Calls allocateNode with the tree's pool, so the node is in a
+ *      pool slot when SLAB_ALLOC is set, otherwise on the heap
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] nodeData
+ *             Data to be stored in node
+ *
+ * @return Pointer to new node
+ *
+ * @note None
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::newNode
+   (
+    const DataType &nodeData     // input: data to be stored
+   )
+{
+    countNodes( 1, 0 );
+
+    return allocateNode( nodeData, nodePool );
+}
+
+/**
+ * @brief Free node method
+ *
+ * @details Destroys a node and returns its memory
+ *          
+ * @pre assumes node was created by newNode of this tree
+ *
+ * @post Node is freed
+ *
+ * @par Algorithm 
+ *      Releases node to the pool when SLAB_ALLOC is set,
+ *      otherwise deletes it
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be freed
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::freeNode
+   (
+    BSTNode<DataType> *workingPtr     // input: node to be freed
+   )
+{
+    countNodes( 0, 1 );
+
+    if( nodePool != NULL )
+    {
+        nodePool->release( workingPtr );
+    }
+
+    else
+    {
+        delete workingPtr;
+    }
+}
+
+/**
+ * @brief Release node method
+ *
+ * @details Drops one reference to a shared subtree
+ *          
+ * @pre assumes caller holds the reference being dropped
+ *
+ * @post Nodes no longer referenced by any tree are freed
+ *
+ * @par Algorithm 
+ *      Decrements the count of the node; the thread taking it to zero
+ *      frees the node and drops its references to both children,
+ *      using an explicit stack rather than recursion
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree to release, may be NULL
+ *
+ * @return None
+ *
+ * @note Stops at the first node still shared, so dropping a snapshot
+ *       frees only the paths copied since it was taken
+ */
+template <class DataType>
+void BSTClass<DataType>::releaseNode
+   (
+    BSTNode<DataType> *workingPtr     // input: subtree to release
+   )
+{
+    vector<BSTNode<DataType> *> nodeStack;
+    BSTNode<DataType> *leftPtr;
+
+    while( workingPtr != NULL || !nodeStack.empty() )
+    {
+        if( workingPtr == NULL )
+        {
+            workingPtr = nodeStack.back();
+            nodeStack.pop_back();
+        }
+
+        if( workingPtr->refCount.fetch_sub( 1, memory_order_acq_rel ) == 1 )
+        {
+            if( workingPtr->right != NULL )
+            {
+                nodeStack.push_back( workingPtr->right );
+            }
+
+            leftPtr = workingPtr->left;
+
+            freeNode( workingPtr );
+
+            workingPtr = leftPtr;
+        }
+
+        else
+        {
+            workingPtr = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Own node method
+ *
+ * @details Makes a node safe to change in place
+ *          
+ * @pre assumes caller may change the link holding the node
+ *
+ * @post Node at link is referenced only by this tree
+ *
+ * @par Algorithm 
+ *      When PERSISTENT is set and the node is shared, replaces it with
+ *      a copy that references the same children, then releases the
+ *      original
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             reference to link holding the node, may hold NULL
+ *
+ * @return None
+ *
+ * @note Other trees keep the original, so they never see the change
+ */
+template <class DataType>
+void BSTClass<DataType>::ownNode
+   (
+    BSTNode<DataType> *&workingPtr     // input: link holding node
+   )
+{
+    BSTNode<DataType> *copyPtr;
+
+    if( ( options & PERSISTENT ) == 0 || workingPtr == NULL
+              || workingPtr->refCount.load( memory_order_acquire ) == 1 )
+    {
+        return;
+    }
+
+    copyPtr = newNode( workingPtr->dataItem );
+    copyPtr->left = workingPtr->left;
+    copyPtr->right = workingPtr->right;
+    copyPtr->height = workingPtr->height;
+    copyPtr->size = workingPtr->size;
+
+    if( copyPtr->left != NULL )
+    {
+        copyPtr->left->refCount.fetch_add( 1, memory_order_relaxed );
+    }
+
+    if( copyPtr->right != NULL )
+    {
+        copyPtr->right->refCount.fetch_add( 1, memory_order_relaxed );
+    }
+
+    releaseNode( workingPtr );
+
+    workingPtr = copyPtr;
+}
+
+/**
+ * @brief Own path method
+ *
+ * @details Makes every node on the recorded path safe to change
+ *          
+ * @pre assumes path holds the links from the root down to
+ *      linkPtr, as recorded by insertHelper or removeHelper
+ *
+ * @post Each recorded node and the node at linkPtr are referenced
+ *       only by this tree, path and linkPtr point into them
+ *
+ * @par Algorithm 
+ *      Calls ownNode on each link from the root down; a link inside a
+ *      node that was just copied is moved to the same side of the copy
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] path
+ *             recorded links, updated
+ *
+ * @param [in] linkPtr
+ *             reference to link below the last recorded one, updated
+ *
+ * @return None
+ *
+ * @note Only the root to leaf path is copied, O(log N) nodes in a
+ *       balanced tree, all else stays shared
+ */
+template <class DataType>
+void BSTClass<DataType>::ownPath
+   (
+    vector<BSTNode<DataType> **> &path,     // input/output: links
+    BSTNode<DataType> **&linkPtr            // input/output: link below path
+   )
+{
+    BSTNode<DataType> **workingLink;
+    BSTNode<DataType> *oldPtr = NULL, *ownedPtr = NULL;
+    size_t index;
+
+    if( ( options & PERSISTENT ) == 0 )
+    {
+        return;
+    }
+
+    for( index = 0; index <= path.size(); index++ )
+    {
+        if( index < path.size() )
+        {
+            workingLink = path[ index ];
+        }
+
+        else
+        {
+            workingLink = linkPtr;
+        }
+
+        if( oldPtr != ownedPtr )
+        {
+            if( workingLink == &oldPtr->left )
+            {
+                workingLink = &ownedPtr->left;
+            }
+
+            else
+            {
+                workingLink = &ownedPtr->right;
+            }
+        }
+
+        oldPtr = *workingLink;
+
+        ownNode( *workingLink );
+
+        ownedPtr = *workingLink;
+
+        if( index < path.size() )
+        {
+            path[ index ] = workingLink;
+        }
+
+        else
+        {
+            linkPtr = workingLink;
+        }
+    }
+}
+
+/**
+ * @brief Adopt tree method
+ *
+ * @details Makes this tree hold the items of another tree
+ *          
+ * @pre assumes this tree is empty and caller holds a read lock
+ *      on the source tree, if it has one
+ *
+ * @post This tree holds the items under sourcePtr
+ *
+ * @par Algorithm 
+ *      With PERSISTENT, takes one more reference to the source root so
+ *      both trees share every node; otherwise calls copyTree method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] sourcePtr
+ *             root of tree to be copied
+ *
+ * @return None
+ *
+ * @note Source must have the same options, so its nodes are
+ *       reference counted whenever this tree shares them
+ */
+template <class DataType>
+void BSTClass<DataType>::adoptTree
+   (
+    BSTNode<DataType> *sourcePtr     // input: root of tree to be copied
+   )
+{
+    if( options & PERSISTENT )
+    {
+        if( sourcePtr != NULL )
+        {
+            sourcePtr->refCount.fetch_add( 1, memory_order_relaxed );
+        }
+
+        rootNode = sourcePtr;
+    }
+
+    else
+    {
+        copyTree( rootNode, sourcePtr, nodePool );
+    }
+}
+
+/**
+ * @brief BSTClass copy method
+ *
+ * @details Assigns BSTClass as copy of input
+ *          
+ * @pre assumes workingPtr is NULL and no other thread is using fromPool
+ *
+ * @post BSTClass object is a copy
+ *
+ * @par Algorithm 
+ *      Moves down left links creating new nodes in pre-order and
+ *      copying data from parameter tree, saving each right subtree
+ *      on an explicit stack
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             BSTClass object to be copied into
+ *
+ * @param [in] sourcePtr
+ *             BSTClass object to be copied from
+ *
+ * @param [in] fromPool
+ *             pool to take node slots from, or NULL for heap nodes
+ *
+ * @return None
+ *
+ * @note Stack depth is bounded by memory, not by the call stack, so a
+ *       degenerate unbalanced tree of any height can be copied
+ */
+template <class DataType>
+void BSTClass<DataType>::copyTree
+   (
+    BSTNode<DataType> *&workingPtr,                 // input: tree assigned
+    const BSTNode<DataType> *sourcePtr,             // input: tree copied
+    BSTNodePool< BSTNode<DataType> > *fromPool      // input: pool or NULL
+   )
+{
+    vector<CopyPiece> copyStack;
+    CopyPiece rightStep;
+    BSTNode<DataType> **destLink = &workingPtr;
+
+    countNodes( nodeSize( sourcePtr ), 0 );
+
+    rightStep.piecePool = fromPool;
+
+    while( sourcePtr != NULL || !copyStack.empty() )
+    {
+        if( sourcePtr == NULL )
+        {
+            destLink = copyStack.back().destLink;
+            sourcePtr = copyStack.back().source;
+            copyStack.pop_back();
+        }
+
+        *destLink = allocateNode( sourcePtr->dataItem, fromPool );
+        (*destLink)->height = sourcePtr->height;
+        (*destLink)->size = sourcePtr->size;
+
+        if( sourcePtr->right != NULL )
+        {
+            rightStep.destLink = &(*destLink)->right;
+            rightStep.source = sourcePtr->right;
+
+            copyStack.push_back( rightStep );
+        }
+
+        destLink = &(*destLink)->left;
+        sourcePtr = sourcePtr->left;
+    }
+}
+
+/**
+ * @brief Parallel copy tree method
+ *
+ * @details Makes this empty tree a copy of a subtree, using all
+ *          workers of pool
+ *          
+ * @pre assumes this tree is empty and caller holds a read lock
+ *      on the source tree, if it has one
+ *
+ * @post BSTClass object is a copy
+ *
+ * @par Algorithm 
+ *      Copies the top levels on this thread, leaving a link for each
+ *      subtree below them, submits one task per subtree and waits for
+ *      the group; with SLAB_ALLOC each task fills a private pool, and
+ *      the tree's pool absorbs them all at the end
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] sourcePtr
+ *             root of tree to be copied
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Nodes are never shared between pools, so no lock is needed
+ */
+template <class DataType>
+void BSTClass<DataType>::parallelCopyTree
+   (
+    const BSTNode<DataType> *sourcePtr,     // input: tree to be copied
+    BSTThreadPool &pool                     // input: workers to run on
+   )
+{
+    vector<CopyPiece> pieces;
+    BSTTaskGroup group;
+    int index;
+
+    splitCopy( rootNode, sourcePtr, pieceDepth( pool ), pieces );
+
+    for( index = 0; index < int( pieces.size() ); index++ )
+    {
+        if( nodePool != NULL )
+        {
+            pieces[ index ].piecePool = new BSTNodePool< BSTNode<DataType> >;
+        }
+
+        pool.submit( group, bind( &BSTClass<DataType>::copyPieceHelper,
+                                                   this, &pieces[ index ] ) );
+    }
+
+    pool.wait( group );
+
+    for( index = 0; index < int( pieces.size() ); index++ )
+    {
+        if( pieces[ index ].piecePool != NULL )
+        {
+            nodePool->absorb( *pieces[ index ].piecePool );
+
+            delete pieces[ index ].piecePool;
+        }
+    }
+}
+
+/**
+ * @brief Split copy method
+ *
+ * @details Copies the top levels of a subtree and records the
+ *          subtrees below them
+ *          
+ * @pre assumes workingPtr is NULL
+ *
+ * @post Top nodes are copied, each recorded piece links below them
+ *
+ * @par Algorithm 
+ *      Records subtree as one piece if depth is used up or subtree is
+ *      short, otherwise copies its root and recurses on both children
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             link to receive copy
+ *
+ * @param [in] sourcePtr
+ *             subtree to be copied
+ *
+ * @param [in] depth
+ *             levels still to split
+ *
+ * @param [out] pieces
+ *              subtrees left for tasks
+ *
+ * @return None
+ *
+ * @note Recursion depth is bounded by depth
+ */
+template <class DataType>
+void BSTClass<DataType>::splitCopy
+   (
+    BSTNode<DataType> *&workingPtr,           // input: link to fill
+    const BSTNode<DataType> *sourcePtr,       // input: subtree to copy
+    int depth,                                // input: levels to split
+    vector<CopyPiece> &pieces                 // output: pieces to copy
+   )
+{
+    CopyPiece piece;
+
+    if( sourcePtr == NULL )
+    {
+        return;
+    }
+
+    if( depth == 0 || sourcePtr->height <= SEQUENTIAL_HEIGHT )
+    {
+        piece.destLink = &workingPtr;
+        piece.source = sourcePtr;
+        piece.piecePool = NULL;
+
+        pieces.push_back( piece );
+    }
+
+    else
+    {
+        workingPtr = newNode( sourcePtr->dataItem );
+        workingPtr->height = sourcePtr->height;
+        workingPtr->size = sourcePtr->size;
+
+        splitCopy( workingPtr->left, sourcePtr->left, depth - 1, pieces );
+        splitCopy( workingPtr->right, sourcePtr->right, depth - 1, pieces );
+    }
+}
+
+/**
+ * @brief Copy piece helper method
+ *
+ * @details Copies one piece recorded by splitCopy
+ *          
+ * @pre assumes piece was made by splitCopy
+ *
+ * @post Copy of piece subtree is linked into the tree
+ *
+ * @par Algorithm 
+ *      Calls copyTree method with the piece's pool
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] piece
+ *             piece to be copied
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::copyPieceHelper
+   (
+    CopyPiece *piece     // input: piece to be copied
+   )
+{
+    copyTree( *piece->destLink, piece->source, piece->piecePool );
+}
+
+/**
+ * @brief Clear helper method
+ *
+ * @details Clears all data in object
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post BSTClass object is empty
+ *
+ * @par Algorithm 
+ *      Frees each node after saving its children on an explicit stack
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be cleared
+ *
+ * @return None
+ *
+ * @note Like copyTree, safe for a degenerate tree of any height
+ */
+template <class DataType>
+void BSTClass<DataType>::clearHelper
+   (
+    BSTNode<DataType> *workingPtr     // input: node to be freed
+   )
+{
+    vector<BSTNode<DataType> *> nodeStack;
+    BSTNode<DataType> *leftPtr;
+
+    while( workingPtr != NULL || !nodeStack.empty() )
+    {
+        if( workingPtr == NULL )
+        {
+            workingPtr = nodeStack.back();
+            nodeStack.pop_back();
+        }
+
+        if( workingPtr->right != NULL )
+        {
+            nodeStack.push_back( workingPtr->right );
+        }
+
+        leftPtr = workingPtr->left;
+
+        freeNode( workingPtr );
+
+        workingPtr = leftPtr;
+    }
+}
+
+/**
+ * @brief Split clear method
+ *
+ * @details Frees the top levels of a subtree and records the
+ *          subtrees below them
+ *          
+ * @pre assumes caller holds the write lock, if any
+ *
+ * @post Top nodes are freed or released, recorded subtrees are not
+ *
+ * @par Algorithm 
+ *      Records subtree as one piece if depth is used up or subtree is
+ *      short; otherwise frees its root, with PERSISTENT only if this was
+ *      the last reference, and recurses on both children
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             subtree to be freed
+ *
+ * @param [in] depth
+ *             levels still to split
+ *
+ * @param [out] subtrees
+ *              subtrees left for tasks
+ *
+ * @return None
+ *
+ * @note Recursion depth is bounded by depth
+ */
+template <class DataType>
+void BSTClass<DataType>::splitClear
+   (
+    BSTNode<DataType> *workingPtr,              // input: subtree to free
+    int depth,                                  // input: levels to split
+    vector<BSTNode<DataType> *> &subtrees       // output: pieces to free
+   )
+{
+    BSTNode<DataType> *leftPtr, *rightPtr;
+
+    if( workingPtr == NULL )
+    {
+        return;
+    }
+
+    if( depth == 0 || workingPtr->height <= SEQUENTIAL_HEIGHT )
+    {
+        subtrees.push_back( workingPtr );
+    }
+
+    else if( ( options & PERSISTENT ) == 0
+         || workingPtr->refCount.fetch_sub( 1, memory_order_acq_rel ) == 1 )
+    {
+        leftPtr = workingPtr->left;
+        rightPtr = workingPtr->right;
+
+        freeNode( workingPtr );
+
+        splitClear( leftPtr, depth - 1, subtrees );
+        splitClear( rightPtr, depth - 1, subtrees );
+    }
+}
+
+/**
+ * @brief Clear piece helper method
+ *
+ * @details Frees one subtree recorded by splitClear
+ *          
+ * @pre assumes subtree was recorded by splitClear
+ *
+ * @post Subtree is freed, with PERSISTENT only nodes no other
+ *       tree holds
+ *
+ * @par Algorithm 
+ *      Calls releaseNode method with PERSISTENT, otherwise
+ *      clearHelper method
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             subtree to be freed
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::clearPieceHelper
+   (
+    BSTNode<DataType> *workingPtr     // input: subtree to be freed
+   )
+{
+    if( options & PERSISTENT )
+    {
+        releaseNode( workingPtr );
+    }
+
+    else
+    {
+        clearHelper( workingPtr );
+    }
+}
+
+/**
+ * @brief Build helper method
+ *
+ * @details Links a balanced subtree of a sorted range
+ *          
+ * @pre assumes items from low to high are strictly ascending
+ *
+ * @post Returned subtree holds the range with correct heights
+ *
+ * @par Algorithm 
+ *      Builds left half, creates middle node, builds right half,
+ *      so nodes are created in sorted order
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] items
+ *             sorted items
+ *
+ * @param [in] low
+ *             index of first item in range
+ *
+ * @param [in] high
+ *             index of last item in range
+ *
+ * @return Root of subtree, NULL for an empty range
+ *
+ * @note Recursion depth is log N
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::buildHelper
+   (
+    const DataType *items,     // input: sorted items
+    int low,                   // input: first index of range
+    int high                   // input: last index of range
+   )
+{
+    BSTNode<DataType> *leftPtr, *workingPtr;
+    int middle;
+
+    if( low > high )
+    {
+        return NULL;
+    }
+
+    middle = low + ( high - low ) / 2;
+
+    leftPtr = buildHelper( items, low, middle - 1 );
+
+    workingPtr = newNode( items[ middle ] );
+    workingPtr->left = leftPtr;
+    workingPtr->right = buildHelper( items, middle + 1, high );
+
+    updateNode( workingPtr );
+
+    return workingPtr;
+}
+
+/**
+ * @brief Parallel build helper method
+ *
+ * @details Links a balanced subtree of a sorted range using
+ *          several threads
+ *          
+ * @pre assumes items from low to high are strictly ascending
+ *
+ * @post Subtree holds the range with correct heights
+ *
+ * @par Algorithm 
+ *      While more than one thread is available, builds the left half
+ *      on a new thread with half of the threads and the right half on
+ *      this one; node for item i goes in slot i of nodeRun if given,
+ *      otherwise on the heap
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [out] workingPtr
+ *              set to root of subtree, NULL for an empty range
+ *
+ * @param [in] items
+ *             sorted items
+ *
+ * @param [in] low
+ *             index of first item in range
+ *
+ * @param [in] high
+ *             index of last item in range
+ *
+ * @param [in] numThreads
+ *             threads available for this range
+ *
+ * @param [in] nodeRun
+ *             preallocated slots, one per item, or NULL
+ *
+ * @return None
+ *
+ * @note Recursion depth is log N
+ */
+template <class DataType>
+void BSTClass<DataType>::parallelBuildHelper
+   (
+    BSTNode<DataType> *&workingPtr,   // output: subtree root
+    const DataType *items,            // input: sorted items
+    int low,                          // input: first index of range
+    int high,                         // input: last index of range
+    int numThreads,                   // input: threads available
+    BSTNode<DataType> *nodeRun        // input: preallocated slots or NULL
+   )
+{
+    BSTNode<DataType> *leftPtr = NULL;
+    thread leftWorker;
+    int middle;
+
+    workingPtr = NULL;
+
+    if( low > high )
+    {
+        return;
+    }
+
+    middle = low + ( high - low ) / 2;
+
+    if( numThreads > 1 )
+    {
+        leftWorker = thread( &BSTClass<DataType>::parallelBuildHelper, this,
+                                   ref( leftPtr ), items, low, middle - 1,
+                                   numThreads / 2, nodeRun );
+    }
+
+    else
+    {
+        parallelBuildHelper( leftPtr, items, low, middle - 1, 1, nodeRun );
+    }
+
+    if( nodeRun != NULL )
+    {
+        workingPtr = new ( nodeRun + middle ) 
+                              BSTNode<DataType>( items[ middle ], NULL, NULL );
+    }
+
+    else
+    {
+        workingPtr = new BSTNode<DataType>( items[ middle ], NULL, NULL );
+    }
+
+    parallelBuildHelper( workingPtr->right, items, middle + 1, high,
+                                      numThreads - numThreads / 2, nodeRun );
+
+    if( leftWorker.joinable() )
+    {
+        leftWorker.join();
+    }
+
+    workingPtr->left = leftPtr;
+
+    updateNode( workingPtr );
+}
+
+/**
+ * @brief Insert helper method
+ *
+ * @details Inserts data in object
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post newData is inserted into object
+ *
+ * @par Algorithm 
+ *      Walks down from workingPtr comparing once per node and recording
+ *      the links passed, copies shared nodes on that path, links the new
+ *      node at the bottom, then retraces the recorded path to update
+ *      heights and rebalance
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree to insert into
+ *
+ * @param [in] newData
+ *             Data to be inserted
+ *
+ * @return None
+ *
+ * @note Duplicates are dropped
+ */
+template <class DataType>
+void BSTClass<DataType>::insertHelper
+   (
+    BSTNode<DataType> *&workingPtr,     // input: subtree root
+    const DataType &newData             // input: data to be inserted
+   )
+{
+    BSTNode<DataType> **linkPtr = &workingPtr;
+    int difference;
+
+    pathStack.clear();
+
+    while( *linkPtr != NULL )
+    {
+        difference = newData.compareTo( (*linkPtr)->dataItem );
+        compareCount++;
+
+        if( difference == 0 )
+        {
+            return;
+        }
+
+        pathStack.push_back( linkPtr );
+
+        if( difference < 0 )
+        {
+            linkPtr = &(*linkPtr)->left;
+        }
+
+        else
+        {
+            linkPtr = &(*linkPtr)->right;
+        }
+    }
+
+    ownPath( pathStack, linkPtr );
+
+    *linkPtr = newNode( newData );
+
+    retracePath( pathStack, 1 );
+}
+
+/**
+ * @brief Find helper method
+ *
+ * @details Finds data in object
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Know if data exists in BST
+ *
+ * @par Algorithm 
+ *      Loops down the tree, comparing data to input once per node
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree to search
+ *
+ * @param [in] searchDataItem
+ *             Data to be searched for
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTClass<DataType>::findHelper
+   (
+    BSTNode<DataType> *workingPtr,     // input: subtree root
+    DataType &searchDataItem           // input: data to be searched for
+   ) const
+{
+    int difference = 1;
+    long long compares = 0;
+
+    while( workingPtr != NULL && difference != 0 )
+    {
+        difference = searchDataItem.compareTo( workingPtr->dataItem );
+        compares++;
+
+        if( difference < 0 )
+        {
+            workingPtr = workingPtr->left;
+        }
+
+        else if( difference > 0 )
+        {
+            workingPtr = workingPtr->right;
+        }
+    }
+
+    countCompares( compares );
+    recordCompares( STAT_FIND, compares );
+
+    return difference == 0;
+}
+
+/**
+ * @brief Count compares method
+ *
+ * @details Adds the compares made by one read only operation
+ *          
+ * @pre assumes caller holds the read lock, if any
+ *
+ * @post Compares are included in getCompareCount
+ *
+ * @par Algorithm 
+ *      Adds to the atomic counter with THREAD_SAFE, 
+ *      otherwise to the plain counter
+ * 
+ * @exception None
+ *
+ * @param [in] compares
+ *             number of compares made
+ *
+ * @return None
+ *
+ * @note Readers may run in parallel, so they add their count once,
+ *       atomically
+ */
+template <class DataType>
+void BSTClass<DataType>::countCompares
+   (
+    long long compares     // input: number of compares made
+   ) const
+{
+    if( treeLock != NULL )
+    {
+        sharedCompareCount.fetch_add( compares, memory_order_relaxed );
+    }
+
+    else
+    {
+        compareCount += compares;
+    }
+}
+
+/**
+ * @brief Stat counters constructor
+ *
+ * @details Constructs counters for BST_STATS
+ *          
+ * @pre assumes Uninitialized StatCounters object
+ *
+ * @post Every counter is zero
+ *
+ * @par Algorithm 
+ *      Stores zero in each counter
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Atomics are not zeroed by default construction; the
+ *       deferred count is shared with the reclaimer
+ */
+template <class DataType>
+BSTClass<DataType>::StatCounters::StatCounters
+   (
+    // no parameters
+   )
+{
+    int kind;
+
+    for( kind = STAT_FIND; kind <= STAT_REMOVE; kind++ )
+    {
+        operations[ kind ] = 0;
+        compares[ kind ] = 0;
+        maxCompares[ kind ] = 0;
+    }
+
+    nodesAllocated = 0;
+    nodesFreed = 0;
+
+    deferredFreed = make_shared< atomic<long long> >( 0 );
+}
+
+/**
+ * @brief Record compares method
+ *
+ * @details Counts one find, insert or remove and its compares
+ *          
+ * @pre assumes caller holds the read or write lock, if any
+ *
+ * @post Operation is included in getStats
+ *
+ * @par Algorithm 
+ *      Adds to the counters of kind and raises its maximum
+ *      if compares exceeds it; does nothing without BST_STATS
+ * 
+ * @exception None
+ *
+ * @param [in] kind
+ *             STAT_FIND, STAT_INSERT or STAT_REMOVE
+ *
+ * @param [in] compares
+ *             number of compares made
+ *
+ * @return None
+ *
+ * @note Relaxed atomics, parallel finds only race on the maximum,
+ *       which is retried until it holds the larger count
+ */
+template <class DataType>
+void BSTClass<DataType>::recordCompares
+   (
+    int kind,               // input: kind of operation
+    long long compares      // input: number of compares made
+   ) const
+{
+#ifdef BST_STATS
+    long long maxSeen 
+               = statCounters.maxCompares[ kind ].load( memory_order_relaxed );
+
+    statCounters.operations[ kind ].fetch_add( 1, memory_order_relaxed );
+    statCounters.compares[ kind ].fetch_add( compares, memory_order_relaxed );
+
+    while( compares > maxSeen 
+          && !statCounters.maxCompares[ kind ].compare_exchange_weak( 
+                               maxSeen, compares, memory_order_relaxed ) )
+    {
+        // maxSeen reloaded by failed exchange
+    }
+#else
+    (void)kind;
+    (void)compares;
+#endif
+}
+
+/**
+ * @brief Count nodes method
+ *
+ * @details Counts nodes created and destroyed by this tree
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Nodes are included in getStats
+ *
+ * @par Algorithm 
+ *      Adds to the node counters; does nothing without BST_STATS
+ * 
+ * @exception None
+ *
+ * @param [in] allocated
+ *             nodes created
+ *
+ * @param [in] freed
+ *             nodes destroyed or handed to the reclaimer
+ *
+ * @return None
+ *
+ * @note Parallel copies, builds and set operations count from
+ *       several threads, so the counters are atomic
+ */
+template <class DataType>
+void BSTClass<DataType>::countNodes
+   (
+    long long allocated,     // input: nodes created
+    long long freed          // input: nodes destroyed
+   ) const
+{
+#ifdef BST_STATS
+    if( allocated != 0 )
+    {
+        statCounters.nodesAllocated.fetch_add( allocated, 
+                                                     memory_order_relaxed );
+    }
+
+    if( freed != 0 )
+    {
+        statCounters.nodesFreed.fetch_add( freed, memory_order_relaxed );
+    }
+#else
+    (void)allocated;
+    (void)freed;
+#endif
+}
+
+/**
+ * @brief Exchange stats method
+ *
+ * @details Exchanges BST_STATS counters with another tree
+ *          
+ * @pre assumes no other thread is using either object
+ *
+ * @post Each object holds the other's counters
+ *
+ * @par Algorithm 
+ *      Exchanges each counter and the deferred count pointer;
+ *      does nothing without BST_STATS
+ * 
+ * @exception None
+ *
+ * @param [in] other
+ *             BSTClass object to exchange with
+ *
+ * @return None
+ *
+ * @note Used by swap and the move constructor, so counts follow
+ *       the nodes they describe
+ */
+template <class DataType>
+void BSTClass<DataType>::exchangeStats
+   (
+    BSTClass<DataType> &other     // input: object to exchange with
+   ) noexcept
+{
+#ifdef BST_STATS
+    StatCounters &mine = statCounters;
+    StatCounters &theirs = other.statCounters;
+    int kind;
+
+    for( kind = STAT_FIND; kind <= STAT_REMOVE; kind++ )
+    {
+        mine.operations[ kind ] = theirs.operations[ kind ].exchange( 
+                   mine.operations[ kind ].load( memory_order_relaxed ),
+                                                     memory_order_relaxed );
+        mine.compares[ kind ] = theirs.compares[ kind ].exchange( 
+                   mine.compares[ kind ].load( memory_order_relaxed ),
+                                                     memory_order_relaxed );
+        mine.maxCompares[ kind ] = theirs.maxCompares[ kind ].exchange( 
+                   mine.maxCompares[ kind ].load( memory_order_relaxed ),
+                                                     memory_order_relaxed );
+    }
+
+    mine.nodesAllocated = theirs.nodesAllocated.exchange( 
+                   mine.nodesAllocated.load( memory_order_relaxed ),
+                                                     memory_order_relaxed );
+    mine.nodesFreed = theirs.nodesFreed.exchange( 
+                   mine.nodesFreed.load( memory_order_relaxed ),
+                                                     memory_order_relaxed );
+
+    mine.deferredFreed.swap( theirs.deferredFreed );
+#else
+    (void)other;
+#endif
+}
+
+/**
+ * @brief Bound helper method
+ *
+ * @details Positions an in-order iterator at the first item after,
+ *          or not before, given data
+ *          
+ * @pre assumes caller holds the read lock, if any
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Walks down once comparing once per node and pushing every node
+ *      passed, as the iterator keeps all ancestors; remembers the depth
+ *      of the last node the walk went left from, or stopped on when
+ *      includeEqual is set, then cuts the stack back to that node
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] boundItem
+ *             Data to search for
+ *
+ * @param [in] includeEqual
+ *             true for lower bound, false for upper bound
+ *
+ * @return Iterator at bound, or end if every item is before it
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::const_iterator BSTClass<DataType>::boundHelper
+   (
+    const DataType &boundItem,     // input: data to search for
+    bool includeEqual              // input: stop on an equal item
+   ) const
+{
+    const_iterator boundIter;
+    const BSTNode<DataType> *workingPtr = rootNode;
+    size_t boundDepth = 0;
+    int difference;
+    long long compares = 0;
+
+    boundIter.rootNode = rootNode;
+
+    while( workingPtr != NULL )
+    {
+        difference = boundItem.compareTo( workingPtr->dataItem );
+        compares++;
+
+        boundIter.nodeStack.push_back( workingPtr );
+
+        if( difference < 0 || ( difference == 0 && includeEqual ) )
+        {
+            boundDepth = boundIter.nodeStack.size();
+
+            if( difference == 0 )
+            {
+                workingPtr = NULL;
+            }
+
+            else
+            {
+                workingPtr = workingPtr->left;
+            }
+        }
+
+        else
+        {
+            workingPtr = workingPtr->right;
+        }
+    }
+
+    boundIter.nodeStack.resize( boundDepth );
+
+    countCompares( compares );
+
+    return boundIter;
+}
+
+/**
+ * @brief Remove helper method
+ *
+ * @details Removes data from object
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data is removed from BST
+ *
+ * @par Algorithm 
+ *      Walks down comparing once per node and recording the links passed;
+ *      a node with two children takes the data of its in-order
+ *      predecessor, whose node is unlinked instead; shared nodes on the
+ *      path are copied before any change; then retraces the recorded
+ *      path to update heights and rebalance
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree to remove from
+ *
+ * @param [in] removeDataItem
+ *             Data to be removed
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTClass<DataType>::removeHelper
+   (
+    BSTNode<DataType> *&workingPtr,    // input: subtree root
+    const DataType &removeDataItem     // input: data to be removed
+   )
+{
+    BSTNode<DataType> **linkPtr = &workingPtr;
+    BSTNode<DataType> *tmp = NULL;
+    size_t foundIndex;
+    int difference;
+
+    pathStack.clear();
+
+    while( *linkPtr != NULL )
+    {
+        difference = removeDataItem.compareTo( (*linkPtr)->dataItem );
+        compareCount++;
+
+        if( difference == 0 )
+        {
+            break;
+        }
+
+        pathStack.push_back( linkPtr );
+
+        if( difference < 0 )
+        {
+            linkPtr = &(*linkPtr)->left;
+        }
+
+        else
+        {
+            linkPtr = &(*linkPtr)->right;
+        }
+    }
+
+    if( *linkPtr == NULL )
+    {
+        return false;
+    }
+
+    tmp = *linkPtr;
+    foundIndex = pathStack.size();
+
+    if( tmp->left != NULL && tmp->right != NULL )
+    {
+        pathStack.push_back( linkPtr );
+        linkPtr = &tmp->left;
+
+        while( (*linkPtr)->right != NULL )
+        {
+            pathStack.push_back( linkPtr );
+            linkPtr = &(*linkPtr)->right;
+        }
+    }
+
+    ownPath( pathStack, linkPtr );
+
+    if( foundIndex < pathStack.size() )
+    {
+        (*pathStack[ foundIndex ])->dataItem = (*linkPtr)->dataItem;
+    }
+
+    tmp = *linkPtr;
+
+    if( tmp->left == NULL )
+    {
+        *linkPtr = tmp->right;
+    }
+
+    else
+    {
+        *linkPtr = tmp->left;
+    }
+
+    freeNode( tmp );
+    tmp = NULL;
+
+    retracePath( pathStack, -1 );
+
+    return true;
+}
+
+/**
+ * @brief Join helper method
+ *
+ * @details Joins two subtrees and a node whose item lies between them
+ *          
+ * @pre assumes every item under lowPtr precedes the pivot item, which
+ *      precedes every item under highPtr; pivot is owned by this tree
+ *
+ * @post Returned subtree holds all items, balanced when selected
+ *
+ * @par Algorithm 
+ *      With AVL_BALANCE, while one subtree is more than one level
+ *      taller, walks down its inner spine to a subtree of about the
+ *      other's height, hangs both there under the pivot and rebalances
+ *      on the way back up; otherwise the pivot becomes the root
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] lowPtr
+ *             subtree of lower items, may be NULL
+ *
+ * @param [in] pivotPtr
+ *             node holding the middle item
+ *
+ * @param [in] highPtr
+ *             subtree of higher items, may be NULL
+ *
+ * @return Root of joined subtree
+ *
+ * @note O(difference in heights), recursion depth likewise
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::joinHelper
+   (
+    BSTNode<DataType> *lowPtr,       // input: subtree of lower items
+    BSTNode<DataType> *pivotPtr,     // input: node of middle item
+    BSTNode<DataType> *highPtr       // input: subtree of higher items
+   )
+{
+    if( options & AVL_BALANCE )
+    {
+        if( nodeHeight( lowPtr ) > nodeHeight( highPtr ) + 1 )
+        {
+            ownNode( lowPtr );
+
+            lowPtr->right = joinHelper( lowPtr->right, pivotPtr, highPtr );
+
+            rebalance( lowPtr );
+
+            return lowPtr;
+        }
+
+        if( nodeHeight( highPtr ) > nodeHeight( lowPtr ) + 1 )
+        {
+            ownNode( highPtr );
+
+            highPtr->left = joinHelper( lowPtr, pivotPtr, highPtr->left );
+
+            rebalance( highPtr );
+
+            return highPtr;
+        }
+    }
+
+    pivotPtr->left = lowPtr;
+    pivotPtr->right = highPtr;
+
+    updateNode( pivotPtr );
+
+    return pivotPtr;
+}
+
+/**
+ * @brief Join trees method
+ *
+ * @details Joins two subtrees, every item of the first preceding
+ *          every item of the second
+ *          
+ * @pre assumes both subtrees are owned by this tree
+ *
+ * @post Returned subtree holds all items, balanced when selected
+ *
+ * @par Algorithm 
+ *      Detaches the first node of the higher subtree with detachFirst
+ *      method and calls joinHelper method with it as pivot
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] lowPtr
+ *             subtree of lower items, may be NULL
+ *
+ * @param [in] highPtr
+ *             subtree of higher items, may be NULL
+ *
+ * @return Root of joined subtree
+ *
+ * @note O(log N) with AVL_BALANCE
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::joinTrees
+   (
+    BSTNode<DataType> *lowPtr,      // input: subtree of lower items
+    BSTNode<DataType> *highPtr      // input: subtree of higher items
+   )
+{
+    BSTNode<DataType> *pivotPtr;
+
+    if( highPtr == NULL )
+    {
+        return lowPtr;
+    }
+
+    pivotPtr = detachFirst( highPtr );
+
+    return joinHelper( lowPtr, pivotPtr, highPtr );
+}
+
+/**
+ * @brief Detach first method
+ *
+ * @details Unlinks the node of the first item of a subtree
+ *          
+ * @pre assumes subtree is not empty
+ *
+ * @post Node is out of the subtree, owned by this tree and has no
+ *       children; subtree is balanced when selected
+ *
+ * @par Algorithm 
+ *      Walks the left links recording them, copies shared nodes on that
+ *      path, links the node's right child in its place, then retraces
+ *      the recorded path
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             reference to subtree root pointer
+ *
+ * @return Detached node
+ *
+ * @note Same steps as removeHelper, but the node is kept; records the
+ *       path in a local vector rather than pathStack, so tasks of a
+ *       set operation can detach nodes in parallel
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::detachFirst
+   (
+    BSTNode<DataType> *&workingPtr     // input: subtree root
+   )
+{
+    BSTNode<DataType> **linkPtr = &workingPtr;
+    BSTNode<DataType> *firstPtr;
+    vector<BSTNode<DataType> **> path;
+
+    while( (*linkPtr)->left != NULL )
+    {
+        path.push_back( linkPtr );
+
+        linkPtr = &(*linkPtr)->left;
+    }
+
+    ownPath( path, linkPtr );
+
+    firstPtr = *linkPtr;
+
+    *linkPtr = firstPtr->right;
+
+    firstPtr->right = NULL;
+
+    retracePath( path, -1 );
+
+    return firstPtr;
+}
+
+/**
+ * @brief Split helper method
+ *
+ * @details Splits a subtree into the items below and above an item
+ *          
+ * @pre assumes caller may change every node of the subtree
+ *
+ * @post lowPtr and highPtr hold the items below and above splitItem,
+ *       balanced when selected
+ *
+ * @par Algorithm 
+ *      Walks down comparing once per node, copying shared nodes and
+ *      recording each node by the side of the split it falls on, until
+ *      splitItem is found or the path ends; then from the bottom up
+ *      joins each recorded node, with the subtree it keeps, onto the
+ *      pieces built so far using joinHelper method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             root of subtree to be split
+ *
+ * @param [in] splitItem
+ *             Data to split at
+ *
+ * @param [out] lowPtr
+ *              root of items below splitItem
+ *
+ * @param [out] highPtr
+ *              root of items above splitItem
+ *
+ * @param [in] compares
+ *             counter to add compares to
+ *
+ * @return Node holding splitItem detached with no children,
+ *         or NULL if not found
+ *
+ * @note O(log N) with AVL_BALANCE, since the joins on each side
+ *       climb heights that only grow; no recursion beyond joinHelper
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::splitHelper
+   (
+    BSTNode<DataType> *workingPtr,     // input: subtree to be split
+    const DataType &splitItem,         // input: data to split at
+    BSTNode<DataType> *&lowPtr,        // output: items below
+    BSTNode<DataType> *&highPtr,       // output: items above
+    long long &compares                // input/output: compare counter
+   )
+{
+    vector<BSTNode<DataType> *> lowNodes, highNodes;
+    BSTNode<DataType> *foundPtr = NULL;
+    int difference;
+
+    lowPtr = NULL;
+    highPtr = NULL;
+
+    while( workingPtr != NULL )
+    {
+        ownNode( workingPtr );
+
+        difference = splitItem.compareTo( workingPtr->dataItem );
+        compares++;
+
+        if( difference == 0 )
+        {
+            foundPtr = workingPtr;
+
+            lowPtr = foundPtr->left;
+            highPtr = foundPtr->right;
+
+            foundPtr->left = NULL;
+            foundPtr->right = NULL;
+
+            updateNode( foundPtr );
+
+            workingPtr = NULL;
+        }
+
+        else if( difference < 0 )
+        {
+            highNodes.push_back( workingPtr );
+
+            workingPtr = workingPtr->left;
+        }
+
+        else
+        {
+            lowNodes.push_back( workingPtr );
+
+            workingPtr = workingPtr->right;
+        }
+    }
+
+    while( !lowNodes.empty() )
+    {
+        workingPtr = lowNodes.back();
+        lowNodes.pop_back();
+
+        lowPtr = joinHelper( workingPtr->left, workingPtr, lowPtr );
+    }
+
+    while( !highNodes.empty() )
+    {
+        workingPtr = highNodes.back();
+        highNodes.pop_back();
+
+        highPtr = joinHelper( highPtr, workingPtr, workingPtr->right );
+    }
+
+    return foundPtr;
+}
+
+/**
+ * @brief Take tree method
+ *
+ * @details Moves the items of another tree into nodes this tree owns
+ *          
+ * @pre assumes no other thread is using source
+ *
+ * @post Returned subtree holds the items of source, balanced when
+ *       selected; source is empty
+ *
+ * @par Algorithm 
+ *      When both trees keep nodes the same way, source shares no node
+ *      unless this tree is PERSISTENT, and source is balanced whenever
+ *      this tree is, takes its root and absorbs its pool;
+ *      otherwise lists its nodes with flattenTree method, copying them
+ *      unless their storage matches, and relinks them balanced
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] source
+ *             tree to be emptied
+ *
+ * @return Root of subtree, NULL if source is empty
+ *
+ * @note O(1) in the common case of two trees with the same options
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::takeTree
+   (
+    BSTClass<DataType> &source     // input: tree to be emptied
+   )
+{
+    vector<BSTNode<DataType> *> nodeList, sharedList;
+    BSTNode<DataType> *takenPtr = source.rootNode;
+    bool reuseNodes = ( nodePool == NULL ) == ( source.nodePool == NULL );
+    size_t index;
+
+    if( takenPtr == NULL )
+    {
+        return NULL;
+    }
+
+    if( reuseNodes 
+         && ( ( options & PERSISTENT ) != 0 
+                               || ( source.options & PERSISTENT ) == 0 )
+         && ( ( options & AVL_BALANCE ) == 0 
+                               || ( source.options & AVL_BALANCE ) != 0 ) )
+    {
+        if( nodePool != NULL )
+        {
+            nodePool->absorb( *source.nodePool );
+        }
+
+        source.rootNode = NULL;
+
+        return takenPtr;
+    }
+
+    flattenTree( takenPtr, reuseNodes, nodeList, sharedList );
+
+    if( reuseNodes )
+    {
+        if( nodePool != NULL )
+        {
+            nodePool->absorb( *source.nodePool );
+        }
+
+        source.rootNode = NULL;
+
+        for( index = 0; index < sharedList.size(); index++ )
+        {
+            releaseNode( sharedList[ index ] );
+        }
+    }
+
+    else
+    {
+        source.clearTree();
+    }
+
+    return relinkHelper( &nodeList[ 0 ], 0, int( nodeList.size() ) - 1 );
+}
+
+/**
+ * @brief Flatten tree method
+ *
+ * @details Lists the nodes of a subtree in order, ready to relink
+ *          
+ * @pre assumes no other thread changes the subtree
+ *
+ * @post nodeList ends with one node per item, in order, each owned
+ *       by this tree
+ *
+ * @par Algorithm 
+ *      Walks the subtree in order on an explicit stack; a node is
+ *      listed itself while it and all its ancestors are referenced only
+ *      from here, otherwise a copy is listed, and the top node of each
+ *      shared subtree is recorded so the caller can drop its reference
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             root of subtree
+ *
+ * @param [in] reuseNodes
+ *             false to copy every node, when the subtree's storage
+ *             is not this tree's
+ *
+ * @param [out] nodeList
+ *              receives the nodes
+ *
+ * @param [out] sharedList
+ *              receives the shared subtrees, still referenced
+ *
+ * @return None
+ *
+ * @note Links of listed nodes are left stale until relinked
+ */
+template <class DataType>
+void BSTClass<DataType>::flattenTree
+   (
+    BSTNode<DataType> *workingPtr,                    // input: subtree
+    bool reuseNodes,                                  // input: may move
+    vector<BSTNode<DataType> *> &nodeList,            // output: nodes
+    vector<BSTNode<DataType> *> &sharedList           // output: shared
+   )
+{
+    vector<FlattenStep> nodeStack;
+    FlattenStep step;
+
+    while( workingPtr != NULL || !nodeStack.empty() )
+    {
+        while( workingPtr != NULL )
+        {
+            if( reuseNodes 
+               && workingPtr->refCount.load( memory_order_acquire ) != 1 )
+            {
+                sharedList.push_back( workingPtr );
+
+                reuseNodes = false;
+            }
+
+            step.node = workingPtr;
+            step.reusable = reuseNodes;
+
+            nodeStack.push_back( step );
+
+            workingPtr = workingPtr->left;
+        }
+
+        step = nodeStack.back();
+        nodeStack.pop_back();
+
+        if( step.reusable )
+        {
+            nodeList.push_back( step.node );
+        }
+
+        else
+        {
+            nodeList.push_back( newNode( step.node->dataItem ) );
+        }
+
+        workingPtr = step.node->right;
+        reuseNodes = step.reusable;
+    }
+}
+
+/**
+ * @brief Set operation method
+ *
+ * @details Combines the items of another tree with this one
+ *          
+ * @pre assumes Initialized BSTClass objects
+ *
+ * @post This tree holds the result, other is unchanged
+ *
+ * @par Algorithm 
+ *      Takes the write lock here and a read lock on other; if other is
+ *      taller than SET_RECURSION_HEIGHT, works from a balanced copy of
+ *      it instead; then calls setHelper method on both roots, splitting
+ *      into tasks down to pieceDepth levels when a pool is given
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] other
+ *             tree to combine with
+ *
+ * @param [in] kind
+ *             SET_UNION, SET_INTERSECTION or SET_DIFFERENCE
+ *
+ * @param [in] pool
+ *             workers to run on, or NULL for this thread only
+ *
+ * @return None
+ *
+ * @note With SLAB_ALLOC runs on this thread, as parallelClear does,
+ *       since the pool is not shared between threads
+ */
+template <class DataType>
+void BSTClass<DataType>::setOperation
+   (
+    const BSTClass<DataType> &other,     // input: tree to combine with
+    int kind,                            // input: operation to apply
+    BSTThreadPool *pool                  // input: workers or NULL
+   )
+{
+    BSTClass<DataType> balancedOther( AVL_BALANCE | ( options & PERSISTENT ) );
+    vector<DataType> otherItems;
+    SetOperation operation;
+    long long compares = 0;
+    int depth = 0;
+
+    if( this == &other )
+    {
+        if( kind == SET_DIFFERENCE )
+        {
+            clear();
+        }
+
+        return;
+    }
+
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    shared_lock<BSTSharedMutex> readGuard = other.readLock();
+
+    operation.kind = kind;
+    operation.source = &other;
+    operation.pool = pool;
+
+    // recursion follows the other tree, so a degenerate one is rebuilt
+    if( nodeHeight( other.rootNode ) > SET_RECURSION_HEIGHT )
+    {
+        otherItems.assign( other.begin(), other.end() );
+
+        balancedOther.buildFromSorted( &otherItems[ 0 ], 
+                                                int( otherItems.size() ) );
+
+        operation.source = &balancedOther;
+    }
+
+    if( pool != NULL && nodePool == NULL )
+    {
+        depth = pieceDepth( *pool );
+    }
+
+    setHelper( rootNode, rootNode, operation.source->rootNode, &operation,
+                                                          depth, &compares );
+
+    compareCount += compares;
+}
+
+/**
+ * @brief Set helper method
+ *
+ * @details Combines a subtree of this tree with a subtree of another
+ *          
+ * @pre assumes caller may change every node under workingPtr,
+ *      and otherPtr belongs to the operation's source tree
+ *
+ * @post resultPtr holds the combined items, balanced when selected
+ *
+ * @par Algorithm 
+ *      Splits this subtree at the item of the other root, combines the
+ *      lower halves and the upper halves, then joins both results,
+ *      around the found node or a new node for that item in a union,
+ *      and without it otherwise; the lower halves go to a task while
+ *      depth remains and the other subtree is tall enough
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [out] resultPtr
+ *              set to root of combined subtree
+ *
+ * @param [in] workingPtr
+ *             subtree of this tree, taken apart
+ *
+ * @param [in] otherPtr
+ *             subtree of the other tree, only read
+ *
+ * @param [in] operation
+ *             operation to apply
+ *
+ * @param [in] depth
+ *             levels still to split into tasks
+ *
+ * @param [in] compares
+ *             counter to add compares to, one per task
+ *
+ * @return None
+ *
+ * @note Subtrees still shared by both trees are the same items, so
+ *       they are combined without being visited
+ */
+template <class DataType>
+void BSTClass<DataType>::setHelper
+   (
+    BSTNode<DataType> *&resultPtr,           // output: combined subtree
+    BSTNode<DataType> *workingPtr,           // input: subtree of this tree
+    const BSTNode<DataType> *otherPtr,       // input: subtree of other
+    const SetOperation *operation,           // input: operation to apply
+    int depth,                               // input: levels to split
+    long long *compares                      // input/output: compares
+   )
+{
+    BSTNode<DataType> *lowPtr, *highPtr, *foundPtr, *leftPtr, *rightPtr;
+    BSTTaskGroup group;
+    long long leftCompares = 0;
+
+    if( workingPtr == otherPtr || otherPtr == NULL || workingPtr == NULL )
+    {
+        if( operation->kind == SET_UNION && workingPtr == NULL )
+        {
+            resultPtr = copySubtree( otherPtr, *operation->source );
+        }
+
+        else if( ( operation->kind == SET_INTERSECTION && otherPtr == NULL )
+            || ( operation->kind == SET_DIFFERENCE && workingPtr == otherPtr ) )
+        {
+            if( options & PERSISTENT )
+            {
+                releaseNode( workingPtr );
+            }
+
+            else
+            {
+                clearHelper( workingPtr );
+            }
+
+            resultPtr = NULL;
+        }
+
+        else
+        {
+            resultPtr = workingPtr;
+        }
+
+        return;
+    }
+
+    foundPtr = splitHelper( workingPtr, otherPtr->dataItem, lowPtr, highPtr,
+                                                                *compares );
+
+    if( depth > 0 && otherPtr->height > SEQUENTIAL_HEIGHT )
+    {
+        operation->pool->submit( group, 
+                       bind( &BSTClass<DataType>::setHelper, this,
+                             ref( leftPtr ), lowPtr, otherPtr->left,
+                             operation, depth - 1, &leftCompares ) );
+
+        setHelper( rightPtr, highPtr, otherPtr->right, operation, 
+                                                      depth - 1, compares );
+
+        operation->pool->wait( group );
+
+        *compares += leftCompares;
+    }
+
+    else
+    {
+        setHelper( leftPtr, lowPtr, otherPtr->left, operation, 
+                                                          depth, compares );
+        setHelper( rightPtr, highPtr, otherPtr->right, operation, 
+                                                          depth, compares );
+    }
+
+    if( operation->kind == SET_UNION && foundPtr == NULL )
+    {
+        foundPtr = newNode( otherPtr->dataItem );
+    }
+
+    else if( operation->kind == SET_DIFFERENCE && foundPtr != NULL )
+    {
+        freeNode( foundPtr );
+
+        foundPtr = NULL;
+    }
+
+    if( foundPtr != NULL )
+    {
+        resultPtr = joinHelper( leftPtr, foundPtr, rightPtr );
+    }
+
+    else
+    {
+        resultPtr = joinTrees( leftPtr, rightPtr );
+    }
+}
+
+/**
+ * @brief Copy subtree method
+ *
+ * @details Gives a subtree of another tree's items owned by this tree
+ *          
+ * @pre assumes caller holds a read lock on source, if it has one
+ *
+ * @post Returned subtree holds the items, balanced when selected
+ *
+ * @par Algorithm 
+ *      Relinks copies balanced with flattenTree and relinkHelper methods
+ *      if this tree is balanced and source is not; otherwise takes one
+ *      more reference when both are PERSISTENT, or calls copyTree method
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] sourcePtr
+ *             subtree to be copied, may be NULL
+ *
+ * @param [in] source
+ *             tree holding the subtree
+ *
+ * @return Root of copy
+ *
+ * @note O(1) between PERSISTENT trees
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::copySubtree
+   (
+    const BSTNode<DataType> *sourcePtr,      // input: subtree to copy
+    const BSTClass<DataType> &source         // input: tree holding it
+   )
+{
+    vector<BSTNode<DataType> *> nodeList, sharedList;
+    BSTNode<DataType> *copyPtr = NULL;
+
+    // source nodes are changed only in their reference counts
+    BSTNode<DataType> *sharedPtr = const_cast<BSTNode<DataType> *>( sourcePtr );
+
+    if( sourcePtr == NULL )
+    {
+        return NULL;
+    }
+
+    if( ( options & AVL_BALANCE ) && ( source.options & AVL_BALANCE ) == 0 )
+    {
+        flattenTree( sharedPtr, false, nodeList, sharedList );
+
+        return relinkHelper( &nodeList[ 0 ], 0, int( nodeList.size() ) - 1 );
+    }
+
+    if( ( options & PERSISTENT ) && ( source.options & PERSISTENT ) )
+    {
+        sharedPtr->refCount.fetch_add( 1, memory_order_relaxed );
+
+        return sharedPtr;
+    }
+
+    copyTree( copyPtr, sourcePtr, nodePool );
+
+    return copyPtr;
+}
+
+/**
+ * @brief Relink helper method
+ *
+ * @details Links a balanced subtree from an ordered list of nodes
+ *          
+ * @pre assumes nodes from low to high hold strictly ascending items
+ *
+ * @post Subtree holds the nodes with correct heights and sizes
+ *
+ * @par Algorithm 
+ *      Makes the middle node the root and relinks each half below it,
+ *      like buildHelper but without allocating
+ * 
+ * @exception None
+ *
+ * @param [in] nodeList
+ *             ordered nodes
+ *
+ * @param [in] low
+ *             index of first node in range
+ *
+ * @param [in] high
+ *             index of last node in range
+ *
+ * @return Root of subtree, NULL for an empty range
+ *
+ * @note Recursion depth is log N
+ */
+template <class DataType>
+BSTNode<DataType> *BSTClass<DataType>::relinkHelper
+   (
+    BSTNode<DataType> **nodeList,     // input: ordered nodes
+    int low,                          // input: first index of range
+    int high                          // input: last index of range
+   )
+{
+    BSTNode<DataType> *workingPtr;
+    int middle;
+
+    if( low > high )
+    {
+        return NULL;
+    }
+
+    middle = low + ( high - low ) / 2;
+
+    workingPtr = nodeList[ middle ];
+    workingPtr->left = relinkHelper( nodeList, low, middle - 1 );
+    workingPtr->right = relinkHelper( nodeList, middle + 1, high );
+
+    updateNode( workingPtr );
+
+    return workingPtr;
+}
+
+/**
+ * @brief Traversal helper
+ *
+ * @details Outputs items from iterator range, one per line
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in range has been output to stream, followed by blank line
+ *
+ * @par Algorithm 
+ *      Formats each item into one reusable buffer and writes the buffer
+ *      to the stream only when it is nearly full, then flushes once
+ *      at the end
+ * 
+ * @exception None
+ *
+ * @param [in] outStream
+ *             stream to receive output
+ *
+ * @param [in] iter
+ *             iterator at first item to output
+ *
+ * @param [in] endIter
+ *             iterator past last item to output
+ *
+ * @return None
+ *
+ * @note Per line endl forced one flush, and one system call, per node
+ */
+template <class DataType>
+template <typename IteratorType>
+void BSTClass<DataType>::traversalHelper
+   (
+    ostream &outStream,        // input: stream to write to
+    IteratorType iter,         // input: first item
+    IteratorType endIter       // input: past last item
+   ) const
+{
+    vector<char> outBuffer( OUTPUT_BUFFER_SIZE );
+    char *bufferStart = &outBuffer[ 0 ];
+    char *bufferEnd = bufferStart + OUTPUT_BUFFER_SIZE;
+    char *writePtr = bufferStart;
+    char *stringEnd;
+
+    for( ; iter != endIter; ++iter )
+    {
+        if( bufferEnd - writePtr <= STD_STR_LEN )
+        {
+            outStream.write( bufferStart, writePtr - bufferStart );
+
+            writePtr = bufferStart;
+        }
+
+        iter->toString( writePtr );
+
+        stringEnd = writePtr;
+
+        while( *stringEnd != '\0' )
+        {
+            stringEnd++;
+        }
+
+        *stringEnd = '\n';
+        writePtr = stringEnd + 1;
+    }
+
+    *writePtr = '\n';
+    writePtr++;
+
+    outStream.write( bufferStart, writePtr - bufferStart );
+    outStream.flush();
+}
+
+/**
+ * @brief Piece depth method
+ *
+ * @details Picks how many levels to split for a parallel walk
+ *          
+ * @pre None
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Smallest depth giving PIECES_PER_THREAD pieces per worker
+ * 
+ * @exception None
+ *
+ * @param [in] pool
+ *             workers the pieces will run on
+ *
+ * @return Number of levels to split
+ *
+ * @note None
+ */
+template <class DataType>
+int BSTClass<DataType>::pieceDepth
+   (
+    const BSTThreadPool &pool     // input: workers to run on
+   )
+{
+    int splitDepth = 0;
+
+    while( ( 1 << splitDepth ) < PIECES_PER_THREAD * pool.getThreadCount() )
+    {
+        splitDepth++;
+    }
+
+    return splitDepth;
+}
+
+/**
+ * @brief Split pieces helper
+ *
+ * @details Cuts top levels of tree into units of parallel work
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Pieces covering the subtree are appended in key order
+ *
+ * @par Algorithm 
+ *      Recursively appends left pieces, the node itself, then right
+ *      pieces, until depth runs out or the subtree is small enough
+ *      to be one piece
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] workingPtr
+ *             root of subtree to be split
+ *
+ * @param [in] depth
+ *             number of levels still to be split
+ *
+ * @param [out] pieces
+ *              list of pieces in key order
+ *
+ * @return None
+ *
+ * @note Recursion is bounded by depth, not by tree height
+ */
+template <class DataType>
+void BSTClass<DataType>::splitPieces
+   (
+    const BSTNode<DataType> *workingPtr,     // input: subtree root
+    int depth,                               // input: levels to split
+    vector<TraversalPiece> &pieces           // output: pieces in order
+   ) const
+{
+    TraversalPiece piece;
+
+    if( workingPtr == NULL )
+    {
+        return;
+    }
+
+    piece.node = workingPtr;
+
+    if( depth == 0 || workingPtr->height <= SEQUENTIAL_HEIGHT )
+    {
+        piece.wholeSubtree = true;
+
+        pieces.push_back( piece );
+    }
+
+    else
+    {
+        piece.wholeSubtree = false;
+
+        splitPieces( workingPtr->left, depth - 1, pieces );
+
+        pieces.push_back( piece );
+
+        splitPieces( workingPtr->right, depth - 1, pieces );
+    }
+}
+
+/**
+ * @brief For each piece helper
+ *
+ * @details Body of one parallelForEach task
+ *          
+ * @pre assumes piece was made by splitPieces
+ *
+ * @post visit has been called on every item of piece
+ *
+ * @par Algorithm 
+ *      Walks a whole subtree with an in-order iterator,
+ *      or visits a single node
+ * 
+ * @exception None
+ *
+ * @param [in] piece
+ *             piece to be visited
+ *
+ * @param [in] visit
+ *             called with each item
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+template <typename VisitType>
+void BSTClass<DataType>::forEachPieceHelper
+   (
+    const TraversalPiece *piece,     // input: piece to be visited
+    VisitType *visit                 // input: called with each item
+   ) const
+{
+    const_iterator iter, endIter;
+
+    if( piece->wholeSubtree )
+    {
+        for( iter = const_iterator( piece->node ); iter != endIter; ++iter )
+        {
+            ( *visit )( *iter );
+        }
+    }
+
+    else
+    {
+        ( *visit )( piece->node->dataItem );
+    }
+}
+
+/**
+ * @brief Reduce piece helper
+ *
+ * @details Body of one parallelReduce task
+ *          
+ * @pre assumes piece was made by splitPieces
+ *
+ * @post Every item of piece is folded into one partial result
+ *
+ * @par Algorithm 
+ *      Picks the result slot of the piece, or of the running worker,
+ *      then folds in items as forEachPieceHelper visits them
+ * 
+ * @exception None
+ *
+ * @param [in] piece
+ *             piece to be folded
+ *
+ * @param [in] results
+ *             partial results
+ *
+ * @param [in] resultIndex
+ *             slot of piece, or NOT_A_WORKER to use the worker's slot
+ *
+ * @param [in] accumulate
+ *             folds one item into a partial result
+ *
+ * @param [in] pool
+ *             pool running the task
+ *
+ * @return None
+ *
+ * @note Only the running worker touches its slot, so no lock is needed
+ */
+template <class DataType>
+template <typename ResultType, typename AccumulateType>
+void BSTClass<DataType>::reducePieceHelper
+   (
+    const TraversalPiece *piece,      // input: piece to be folded
+    ResultType *results,              // input/output: partial results
+    int resultIndex,                  // input: slot to fold into
+    AccumulateType *accumulate,       // input: folds in one item
+    const BSTThreadPool *pool         // input: pool running the task
+   ) const
+{
+    const_iterator iter, endIter;
+
+    if( resultIndex == BSTThreadPool::NOT_A_WORKER )
+    {
+        resultIndex = pool->getWorkerIndex();
+    }
+
+    if( piece->wholeSubtree )
+    {
+        for( iter = const_iterator( piece->node ); iter != endIter; ++iter )
+        {
+            ( *accumulate )( results[ resultIndex ], *iter );
+        }
+    }
+
+    else
+    {
+        ( *accumulate )( results[ resultIndex ], piece->node->dataItem );
+    }
+}
+
+/**
+ * @brief get cached height of node
+ *
+ * @details returns stored height of node, 0 for empty subtree
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Height of node has been returned
+ *
+ * @par Algorithm 
+ *      Reads height member of node if node exists
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to find height of
+ *
+ * @return Height of node as int
+ *
+ * @note None
+ */
+template <class DataType>
+int BSTClass<DataType>::nodeHeight
+   (
+    const BSTNode<DataType> *workingPtr     // input: node to find height of
+   ) const
+{
+    if( workingPtr == NULL )
+    {
+        return 0;
+    }
+
+    return workingPtr->height;
+}
+
+/**
+ * @brief get cached size of subtree
+ *
+ * @details returns stored node count of subtree, 0 for empty subtree
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Size of subtree has been returned
+ *
+ * @par Algorithm 
+ *      Reads size member of node if node exists
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree to find size of
+ *
+ * @return Number of nodes in subtree as int
+ *
+ * @note None
+ */
+template <class DataType>
+int BSTClass<DataType>::nodeSize
+   (
+    const BSTNode<DataType> *workingPtr     // input: subtree root
+   ) const
+{
+    if( workingPtr == NULL )
+    {
+        return 0;
+    }
+
+    return workingPtr->size;
+}
+
+/**
+ * @brief update cached height and size of node
+ *
+ * @details recomputes stored height and subtree size of node
+ *          from its children
+ *          
+ * @pre assumes children of node hold correct heights and sizes
+ *
+ * @post Height and size of node are correct
+ *
+ * @par Algorithm 
+ *      Takes larger of child heights and adds one,
+ *      adds child sizes and one
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be updated
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::updateNode
+   (
+    BSTNode<DataType> *workingPtr     // input: node to be updated
+   )
+{
+    int leftH = nodeHeight( workingPtr->left );
+    int rightH = nodeHeight( workingPtr->right );
+
+    if( rightH > leftH )
+    {
+        workingPtr->height = rightH + 1;
+    }
+
+    else
+    {
+        workingPtr->height = leftH + 1;
+    }
+
+    workingPtr->size = nodeSize( workingPtr->left ) 
+                                         + nodeSize( workingPtr->right ) + 1;
+}
+
+/**
+ * @brief rotate subtree left
+ *
+ * @details right child of node becomes subtree root
+ *          
+ * @pre assumes node has a right child
+ *
+ * @post Subtree is rotated, in order sequence is unchanged
+ *
+ * @par Algorithm 
+ *      Copies both nodes if shared, moves right child up, moves its
+ *      left subtree under old root, then updates heights and sizes
+ *      bottom up
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             reference to subtree root pointer
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::rotateLeft
+   (
+    BSTNode<DataType> *&workingPtr     // input: subtree root to rotate
+   )
+{
+    BSTNode<DataType> *pivot;
+
+    ownNode( workingPtr );
+    ownNode( workingPtr->right );
+
+    pivot = workingPtr->right;
+
+    workingPtr->right = pivot->left;
+    pivot->left = workingPtr;
+
+    updateNode( workingPtr );
+    updateNode( pivot );
+
+    workingPtr = pivot;
+}
+
+/**
+ * @brief rotate subtree right
+ *
+ * @details left child of node becomes subtree root
+ *          
+ * @pre assumes node has a left child
+ *
+ * @post Subtree is rotated, in order sequence is unchanged
+ *
+ * @par Algorithm 
+ *      Copies both nodes if shared, moves left child up, moves its
+ *      right subtree under old root, then updates heights and sizes
+ *      bottom up
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             reference to subtree root pointer
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::rotateRight
+   (
+    BSTNode<DataType> *&workingPtr     // input: subtree root to rotate
+   )
+{
+    BSTNode<DataType> *pivot;
+
+    ownNode( workingPtr );
+    ownNode( workingPtr->left );
+
+    pivot = workingPtr->left;
+
+    workingPtr->left = pivot->right;
+    pivot->right = workingPtr;
+
+    updateNode( workingPtr );
+    updateNode( pivot );
+
+    workingPtr = pivot;
+}
+
+/**
+ * @brief rebalance subtree
+ *
+ * @details restores height and, with AVL_BALANCE, the AVL property
+ *          
+ * @pre assumes both child subtrees are balanced with correct heights
+ *
+ * @post Height of node is correct, subtree is balanced when selected
+ *
+ * @par Algorithm 
+ *      Updates height and size, then if the child heights differ by
+ *      more than one applies a single or double rotation toward the shorter side
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             reference to subtree root pointer
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::rebalance
+   (
+    BSTNode<DataType> *&workingPtr     // input: subtree root to balance
+   )
+{
+    int balance;
+
+    updateNode( workingPtr );
+
+    if( ( options & AVL_BALANCE ) == 0 )
+    {
+        return;
+    }
+
+    balance = nodeHeight( workingPtr->left ) - nodeHeight( workingPtr->right );
+
+    if( balance > 1 )
+    {
+        if( nodeHeight( workingPtr->left->left ) 
+                                   < nodeHeight( workingPtr->left->right ) )
+        {
+            rotateLeft( workingPtr->left );
+        }
+
+        rotateRight( workingPtr );
+    }
+
+    else if( balance < -1 )
+    {
+        if( nodeHeight( workingPtr->right->right ) 
+                                   < nodeHeight( workingPtr->right->left ) )
+        {
+            rotateRight( workingPtr->right );
+        }
+
+        rotateLeft( workingPtr );
+    }
+}
+
+/**
+ * @brief retrace modified path
+ *
+ * @details restores heights, sizes and balance along the recorded path
+ *          
+ * @pre assumes path holds the links from the root down to the
+ *      point of modification
+ *
+ * @post Heights and sizes along the path are correct, tree is balanced
+ *       when selected
+ *
+ * @par Algorithm 
+ *      Rebalances each recorded link from the bottom up until a subtree
+ *      height is unchanged, since no rotation can be needed above it;
+ *      the rest of the path only has sizeChange added to its sizes
+ * 
+ * @exception None
+ *
+ * @param [in] path
+ *             recorded links, emptied
+ *
+ * @param [in] sizeChange
+ *             items added below the path, 1 or -1
+ *
+ * @return None
+ *
+ * @note Sizes change all the way to the root, but adding the change
+ *       avoids reading the child off the path, a likely cache miss
+ */
+template <class DataType>
+void BSTClass<DataType>::retracePath
+   (
+    vector<BSTNode<DataType> **> &path,     // input: links to retrace
+    int sizeChange                          // input: items added below
+   )
+{
+    BSTNode<DataType> **linkPtr;
+    int oldHeight;
+    bool heightChanged = true;
+
+    while( !path.empty() )
+    {
+        linkPtr = path.back();
+        path.pop_back();
+
+        if( heightChanged )
+        {
+            oldHeight = (*linkPtr)->height;
+
+            rebalance( *linkPtr );
+
+            heightChanged = (*linkPtr)->height != oldHeight;
+        }
+
+        else
+        {
+            (*linkPtr)->size += sizeChange;
+        }
+    }
+}
+
+/**
+ * @brief show BST structure helper
+ *
+ * @details Displays one row of the structure of BST
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Row has been output to stream, followed by end of line
+ *
+ * @par Algorithm 
+ *      Writes the spaces before each slot and its data, or EMPTY_STR
+ *      for a missing node, into one buffer, written to the stream only
+ *      when it is nearly full and at the end of the row; spacing is
+ *      2^rowHeight - 1 before the first slot and 2^( rowHeight + 1 ) - 3
+ *      before each other one, computed with shifts
+ * 
+ * @exception None
+ *
+ * @param [in] outStream
+ *             stream to receive output
+ *
+ * @param [in] rowSlots
+ *             nodes of the row from left to right, NULL where missing
+ *
+ * @param [in] rowHeight
+ *             rows shown from this one down, 1 for the last
+ *
+ * @param [in] elideBelow
+ *             true to mark nodes with children by ELIDED_STR
+ *
+ * @param [in] outBuffer
+ *             buffer of OUTPUT_BUFFER_SIZE bytes, reused per row
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::structureHelper
+   (
+    ostream &outStream,                                  // input: stream
+    const vector<const BSTNode<DataType> *> &rowSlots,   // input: row
+    int rowHeight,                                       // input: spacing
+    bool elideBelow,                                     // input: mark
+    vector<char> &outBuffer                              // input: buffer
+   ) const
+{
+    char *bufferStart = &outBuffer[ 0 ];
+    char *bufferEnd = bufferStart + OUTPUT_BUFFER_SIZE;
+    char *writePtr = bufferStart;
+    const BSTNode<DataType> *workingPtr;
+    int numStartSpaces = ( 1 << rowHeight ) - 1;
+    int numSepSpaces = ( 1 << ( rowHeight + 1 ) ) - 3;
+    int spaceCount, chunkSize;
+    size_t index;
+
+    for( index = 0; index < rowSlots.size(); index++ )
+    {
+        if( index == 0 )
+        {
+            spaceCount = numStartSpaces;
+        }
+
+        else
+        {
+            spaceCount = numSepSpaces;
+        }
+
+        // keeps room for one item and its mark after every chunk
+        while( spaceCount > 0 )
+        {
+            if( bufferEnd - writePtr <= 2 * STD_STR_LEN )
+            {
+                outStream.write( bufferStart, writePtr - bufferStart );
+
+                writePtr = bufferStart;
+            }
+
+            chunkSize = min( spaceCount, 
+                           int( bufferEnd - writePtr ) - 2 * STD_STR_LEN );
+
+            fill( writePtr, writePtr + chunkSize, ' ' );
+
+            writePtr += chunkSize;
+            spaceCount -= chunkSize;
+        }
+
+        if( bufferEnd - writePtr <= 2 * STD_STR_LEN )
+        {
+            outStream.write( bufferStart, writePtr - bufferStart );
+
+            writePtr = bufferStart;
+        }
+
+        workingPtr = rowSlots[ index ];
+
+        if( workingPtr != NULL )
+        {
+            workingPtr->dataItem.toString( writePtr );
+        }
+
+        else
+        {
+            copy( EMPTY_STR, EMPTY_STR + sizeof( EMPTY_STR ), writePtr );
+        }
+
+        while( *writePtr != '\0' )
+        {
+            writePtr++;
+        }
+
+        if( elideBelow && workingPtr != NULL 
+                && ( workingPtr->left != NULL || workingPtr->right != NULL ) )
+        {
+            writePtr = copy( ELIDED_STR, 
+                           ELIDED_STR + sizeof( ELIDED_STR ) - 1, writePtr );
+        }
+    }
+
+    *writePtr = '\n';
+    writePtr++;
+
+    outStream.write( bufferStart, writePtr - bufferStart );
+}
+
+/**
+ * @brief show BST structure
+ *
+ * @details Displays structure of BST
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to screen
+ *
+ * @par Algorithm 
+ *      Shows at most MAX_STRUCTURE_DEPTH rows, see the stream version
+ * 
+ * @exception None
+ *
+ * @param [in] ID
+ *             char to denote ID of tree being displayed
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::showBSTStructure
+   (
+    char ID     // input: id of tree to show
+   ) const
+{
+    showBSTStructure( cout, ID, MAX_STRUCTURE_DEPTH );
+}
+
+/**
+ * @brief show BST structure to stream
+ *
+ * @details Displays the top rows of the structure of BST
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in BST has been output to stream
+ *
+ * @par Algorithm 
+ *      Walks the tree level by level, keeping one slot per position of
+ *      the current row, NULL where the node is missing; calls
+ *      structureHelper method for each row, then makes the next row
+ *      from the children of each slot
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] outStream
+ *             stream to receive output
+ *
+ * @param [in] ID
+ *             char to denote ID of tree being displayed
+ *
+ * @param [in] maxDepth
+ *             most rows to show, at most MAX_STRUCTURE_DEPTH; nodes of
+ *             the last row shown that have children are marked
+ *             with ELIDED_STR
+ *
+ * @return None
+ *
+ * @note Time and output are O(2^rows), whatever the size of the tree;
+ *       every row is written in one pass and the height is cached
+ */
+template <class DataType>
+void BSTClass<DataType>::showBSTStructure
+   (
+    ostream &outStream,     // input: stream to write to
+    char ID,                // input: id of tree to show
+    int maxDepth            // input: most rows to show
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    vector<const BSTNode<DataType> *> rowSlots, nextSlots;
+    vector<char> outBuffer( OUTPUT_BUFFER_SIZE );
+    int height = nodeHeight( rootNode );
+    int rowHeight;
+    size_t index;
+
+    maxDepth = min( max( maxDepth, 0 ), int( MAX_STRUCTURE_DEPTH ) );
+
+    outStream << "BST ID " << ID << ":" << endl;
+
+    if( height > maxDepth )
+    {
+        height = maxDepth;
+    }
+
+    rowSlots.push_back( rootNode );
+
+    for( rowHeight = height; rowHeight > 0; rowHeight-- )
+    {
+        structureHelper( outStream, rowSlots, rowHeight,
+                    rowHeight == 1 && nodeHeight( rootNode ) > height,
+                                                               outBuffer );
+
+        nextSlots.clear();
+
+        for( index = 0; index < rowSlots.size() && rowHeight > 1; index++ )
+        {
+            if( rowSlots[ index ] != NULL )
+            {
+                nextSlots.push_back( rowSlots[ index ]->left );
+                nextSlots.push_back( rowSlots[ index ]->right );
+            }
+
+            else
+            {
+                nextSlots.push_back( NULL );
+                nextSlots.push_back( NULL );
+            }
+        }
+
+        rowSlots.swap( nextSlots );
+    }
+
+    outStream << endl;
+}
+
+
+/**
+ * @brief get comparison count
+ *
+ * @details Returns number of data comparisons made by insert, find
+ *          and remove since construction or last reset
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Comparison count has been returned
+ *
+ * @par Algorithm 
+ *      Returns counter member
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Number of comparisons as long long
+ *
+ * @note None
+ */
+template <class DataType>
+long long BSTClass<DataType>::getCompareCount
+   (
+    // no parameters
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    return compareCount + sharedCompareCount;
+}
+
+/**
+ * @brief reset comparison count
+ *
+ * @details Sets comparison counter back to zero
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Comparison count is zero
+ *
+ * @par Algorithm 
+ *      Clears counter member
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTClass<DataType>::resetCompareCount
+   (
+    // no parameters
+   )
+{
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+
+    compareCount = 0;
+    sharedCompareCount = 0;
+}
+
+/**
+ * @brief Get stats method
+ *
+ * @details Describes the shape of the tree and, when compiled with
+ *          BST_STATS, the cost of its operations
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Walks every node with an explicit stack, counting nodes per
+ *      depth and summing depths; then copies the operation and node
+ *      counters and divides compares by operations
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return BSTStats with shape and counts
+ *
+ * @note O(N) for the shape, the counters are O(1) per operation;
+ *       nodes moved in by join or merge, or out by split, are
+ *       not counted as allocated or freed
+ */
+template <class DataType>
+BSTStats BSTClass<DataType>::getStats
+   (
+    // no parameters
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    vector<const BSTNode<DataType> *> nodeStack;
+    vector<int> depthStack;
+    const BSTNode<DataType> *workingPtr;
+    BSTStats stats = BSTStats();
+    long long depthSum = 0;
+    int depth;
+
+    stats.nodeCount = nodeSize( rootNode );
+    stats.height = nodeHeight( rootNode );
+    stats.depthCounts.assign( stats.height, 0 );
+
+    if( rootNode != NULL )
+    {
+        nodeStack.push_back( rootNode );
+        depthStack.push_back( 0 );
+    }
+
+    while( !nodeStack.empty() )
+    {
+        workingPtr = nodeStack.back();
+        depth = depthStack.back();
+
+        nodeStack.pop_back();
+        depthStack.pop_back();
+
+        stats.depthCounts[ depth ]++;
+        depthSum += depth + 1;
+
+        if( workingPtr->left != NULL )
+        {
+            nodeStack.push_back( workingPtr->left );
+            depthStack.push_back( depth + 1 );
+        }
+
+        if( workingPtr->right != NULL )
+        {
+            nodeStack.push_back( workingPtr->right );
+            depthStack.push_back( depth + 1 );
+        }
+    }
+
+    if( stats.nodeCount > 0 )
+    {
+        stats.averagePathLength = double( depthSum ) / stats.nodeCount;
+    }
+
+#ifdef BST_STATS
+    stats.countsKept = true;
+
+    stats.findCount = statCounters.operations[ STAT_FIND ];
+    stats.insertCount = statCounters.operations[ STAT_INSERT ];
+    stats.removeCount = statCounters.operations[ STAT_REMOVE ];
+
+    if( stats.findCount > 0 )
+    {
+        stats.averageFindCompares 
+                  = double( statCounters.compares[ STAT_FIND ] ) 
+                                                          / stats.findCount;
+    }
+
+    if( stats.insertCount > 0 )
+    {
+        stats.averageInsertCompares 
+                  = double( statCounters.compares[ STAT_INSERT ] ) 
+                                                        / stats.insertCount;
+    }
+
+    if( stats.removeCount > 0 )
+    {
+        stats.averageRemoveCompares 
+                  = double( statCounters.compares[ STAT_REMOVE ] ) 
+                                                        / stats.removeCount;
+    }
+
+    stats.maxFindCompares = statCounters.maxCompares[ STAT_FIND ];
+    stats.maxInsertCompares = statCounters.maxCompares[ STAT_INSERT ];
+    stats.maxRemoveCompares = statCounters.maxCompares[ STAT_REMOVE ];
+
+    stats.nodesAllocated = statCounters.nodesAllocated;
+    stats.nodesFreed = statCounters.nodesFreed 
+                                            + *statCounters.deferredFreed;
+#endif
+
+    return stats;
+}
+
+/**
+ * @brief Reset stats method
+ *
+ * @details Sets the BST_STATS counters back to zero
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Operation and node counts start again from zero
+ *
+ * @par Algorithm 
+ *      Clears each counter under the write lock
+ * 
+ * @exception bad_alloc if memory is exhausted, only with BST_STATS
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Does nothing without BST_STATS; the shape is never reset
+ */
+template <class DataType>
+void BSTClass<DataType>::resetStats
+   (
+    // no parameters
+   )
+{
+#ifdef BST_STATS
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    int kind;
+
+    for( kind = STAT_FIND; kind <= STAT_REMOVE; kind++ )
+    {
+        statCounters.operations[ kind ] = 0;
+        statCounters.compares[ kind ] = 0;
+        statCounters.maxCompares[ kind ] = 0;
+    }
+
+    statCounters.nodesAllocated = 0;
+    statCounters.nodesFreed = 0;
+
+    // graphs still pending keep the old count
+    statCounters.deferredFreed = make_shared< atomic<long long> >( 0 );
+#endif
+}
+
+/**
+ * @brief Freeze method
+ *
+ * @details Produces a read only snapshot for lookup heavy phases
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Tree is unchanged
+ *
+ * @par Algorithm 
+ *      Collects items in order with an explicit stack,
+ *      then lays them out in Eytzinger order in one array
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return FrozenBSTClass holding copies of all items
+ *
+ * @note Later changes to the tree do not affect the snapshot
+ */
+template <class DataType>
+FrozenBSTClass<DataType> BSTClass<DataType>::freeze
+   (
+    // no parameters
+   ) const
+{
+    vector<DataType> sortedItems;
+    vector<const BSTNode<DataType> *> nodeStack;
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    const BSTNode<DataType> *workingPtr = rootNode;
+
+    while( workingPtr != NULL || !nodeStack.empty() )
+    {
+        while( workingPtr != NULL )
+        {
+            nodeStack.push_back( workingPtr );
+            workingPtr = workingPtr->left;
+        }
+
+        workingPtr = nodeStack.back();
+        nodeStack.pop_back();
+
+        sortedItems.push_back( workingPtr->dataItem );
+
+        workingPtr = workingPtr->right;
+    }
+
+    return FrozenBSTClass<DataType>( sortedItems );
+}
+
+/**
+ * @brief Snapshot method
+ *
+ * @details Gives an independent version of the tree as it is now
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Returned tree holds the current items, later changes to
+ *       either tree do not affect the other
+ *
+ * @par Algorithm 
+ *      Calls copy constructor, which with PERSISTENT shares every node;
+ *      each later insert or remove copies only the shared nodes on
+ *      its path
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return BSTClass with the same options and items
+ *
+ * @note O(1) with PERSISTENT, O(N) otherwise; shared nodes are never
+ *       changed, so the snapshot may be read on other threads while
+ *       this tree keeps changing
+ */
+template <class DataType>
+BSTClass<DataType> BSTClass<DataType>::snapshot
+   (
+    // no parameters
+   ) const
+{
+    return BSTClass<DataType>( *this );
+}
+
+/**
+ * @brief begin method
+ *
+ * @details Gives in-order iterator at smallest item
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator from root
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Iterator at first item, or end if empty
+ *
+ * @note Iterators are invalidated by any change to the tree,
+ *       and hold no lock even with THREAD_SAFE
+ */
+template <class DataType>
+typename BSTClass<DataType>::const_iterator BSTClass<DataType>::begin
+   (
+    // no parameters
+   ) const
+{
+    return const_iterator( rootNode );
+}
+
+/**
+ * @brief end method
+ *
+ * @details Gives in-order iterator past the largest item
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator with empty stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return End iterator, decrementing it gives the largest item
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::const_iterator BSTClass<DataType>::end
+   (
+    // no parameters
+   ) const
+{
+    const_iterator endIter;
+
+    endIter.rootNode = rootNode;
+
+    return endIter;
+}
+
+/**
+ * @brief Lower bound method
+ *
+ * @details Gives in-order iterator at first item not before given data
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Calls boundHelper method, stopping on an equal item
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] lowItem
+ *             Data to search for, need not be in the tree
+ *
+ * @return Iterator at first item not less than lowItem, or end
+ *
+ * @note O(log N) with AVL_BALANCE; invalidated like begin
+ */
+template <class DataType>
+typename BSTClass<DataType>::const_iterator BSTClass<DataType>::lowerBound
+   (
+    const DataType &lowItem     // input: data to search for
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    return boundHelper( lowItem, true );
+}
+
+/**
+ * @brief Upper bound method
+ *
+ * @details Gives in-order iterator at first item after given data
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Calls boundHelper method, passing over an equal item
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] highItem
+ *             Data to search for, need not be in the tree
+ *
+ * @return Iterator at first item greater than highItem, or end
+ *
+ * @note O(log N) with AVL_BALANCE; with lowerBound gives the range
+ *       [ lowerBound( low ), upperBound( high ) ) of items from low
+ *       to high inclusive, when low is not after high
+ */
+template <class DataType>
+typename BSTClass<DataType>::const_iterator BSTClass<DataType>::upperBound
+   (
+    const DataType &highItem     // input: data to search for
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    return boundHelper( highItem, false );
+}
+
+/**
+ * @brief pre-order begin method
+ *
+ * @details Gives pre-order iterator at root
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator from root
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Iterator at first item, or end if empty
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::pre_order_iterator 
+BSTClass<DataType>::preOrderBegin
+   (
+    // no parameters
+   ) const
+{
+    return pre_order_iterator( rootNode );
+}
+
+/**
+ * @brief pre-order end method
+ *
+ * @details Gives pre-order iterator past the last item
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator with empty stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return End iterator
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::pre_order_iterator 
+BSTClass<DataType>::preOrderEnd
+   (
+    // no parameters
+   ) const
+{
+    return pre_order_iterator();
+}
+
+/**
+ * @brief post-order begin method
+ *
+ * @details Gives post-order iterator at first leaf
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator from root
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Iterator at first item, or end if empty
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::post_order_iterator 
+BSTClass<DataType>::postOrderBegin
+   (
+    // no parameters
+   ) const
+{
+    return post_order_iterator( rootNode );
+}
+
+/**
+ * @brief post-order end method
+ *
+ * @details Gives post-order iterator past the root
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Constructs iterator with empty stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return End iterator
+ *
+ * @note None
+ */
+template <class DataType>
+typename BSTClass<DataType>::post_order_iterator 
+BSTClass<DataType>::postOrderEnd
+   (
+    // no parameters
+   ) const
+{
+    return post_order_iterator();
+}
+
+/**
+ * @brief Range traversal
+ *
+ * @details Outputs items from lowItem to highItem inclusive, in order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post Data in range has been output to stream
+ *
+ * @par Algorithm 
+ *      Finds both ends with boundHelper under one read lock, then calls
+ *      traversalHelper on the iterators between them
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] outStream
+ *             stream to receive output
+ *
+ * @param [in] lowItem
+ *             smallest item of range, need not be in the tree
+ *
+ * @param [in] highItem
+ *             largest item of range, need not be in the tree
+ *
+ * @return None
+ *
+ * @note O(log N + K) for K items in range, with AVL_BALANCE;
+ *       an empty range prints only the blank line
+ */
+template <class DataType>
+void BSTClass<DataType>::rangeTraversal
+   (
+    ostream &outStream,             // input: stream to write to
+    const DataType &lowItem,        // input: smallest item of range
+    const DataType &highItem        // input: largest item of range
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+
+    if( lowItem.compareTo( highItem ) > 0 )
+    {
+        traversalHelper( outStream, end(), end() );
+    }
+
+    else
+    {
+        traversalHelper( outStream, boundHelper( lowItem, true ), 
+                                        boundHelper( highItem, false ) );
+    }
+}
+
+/**
+ * @brief For each in range method
+ *
+ * @details Calls visit on every item from lowItem to highItem
+ *          inclusive, in order
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post visit has been called once per item in range
+ *
+ * @par Algorithm 
+ *      Descends once to the first item not less than lowItem with
+ *      boundHelper, then steps the iterator, comparing each item with
+ *      highItem, until one is past it
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] lowItem
+ *             smallest item of range, need not be in the tree
+ *
+ * @param [in] highItem
+ *             largest item of range, need not be in the tree
+ *
+ * @param [in] visit
+ *             function or function object called with each item
+ *
+ * @return None
+ *
+ * @note O(log N + K) for K items in range, with AVL_BALANCE; holds the
+ *       read lock throughout, so visit must not change this tree
+ */
+template <class DataType>
+template <typename VisitType>
+void BSTClass<DataType>::forEachInRange
+   (
+    const DataType &lowItem,        // input: smallest item of range
+    const DataType &highItem,       // input: largest item of range
+    VisitType visit                 // input: called with each item
+   ) const
+{
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    const_iterator iter = boundHelper( lowItem, true ), endIter;
+    long long compares = 0;
+
+    while( iter != endIter )
+    {
+        compares++;
+
+        if( iter->compareTo( highItem ) > 0 )
+        {
+            break;
+        }
+
+        visit( *iter );
+
+        ++iter;
+    }
+
+    countCompares( compares );
+}
+
+/**
+ * @brief Parallel clear method
+ *
+ * @details Clears all data in object, using all workers of pool
+ *          
+ * @pre assumes Initialized BSTClass object
+ *
+ * @post BSTClass object is empty
+ *
+ * @par Algorithm 
+ *      Frees the top levels on this thread, then submits one task per
+ *      subtree below them and waits for the group; SLAB_ALLOC trees
+ *      call clearTree method, which frees whole blocks instead
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Same result as clear; slab nodes can not be released to their
+ *       pool by several threads at once
+ */
+template <class DataType>
+void BSTClass<DataType>::parallelClear
+   (
+    BSTThreadPool &pool       // input: workers to run on
+   )
+{
+    vector<BSTNode<DataType> *> subtrees;
+    BSTTaskGroup group;
+    unique_lock<BSTSharedMutex> writeGuard = writeLock();
+    int index;
+
+    if( nodePool != NULL )
+    {
+        clearTree();
+    }
+
+    else
+    {
+        splitClear( rootNode, pieceDepth( pool ), subtrees );
+
+        rootNode = NULL;
+
+        for( index = 0; index < int( subtrees.size() ); index++ )
+        {
+            pool.submit( group, bind( &BSTClass<DataType>::clearPieceHelper,
+                                                   this, subtrees[ index ] ) );
+        }
+
+        pool.wait( group );
+    }
+}
+
+/**
+ * @brief Parallel for each method
+ *
+ * @details Calls visit on every item, using all workers of pool
+ *          
+ * @pre assumes Initialized BSTClass object, tree is not changed
+ *      until the method returns
+ *
+ * @post visit has been called once per item
+ *
+ * @par Algorithm 
+ *      Splits the top levels of the tree into pieces, submits one task
+ *      per piece and waits for the group; idle workers steal pieces
+ *      from busy ones so uneven subtrees balance out
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] visit
+ *             function or function object called with each item,
+ *             must be safe to call from several threads at once
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return None
+ *
+ * @note Items within one piece are visited in order, but pieces run
+ *       in no fixed order; use parallelReduce when order matters
+ */
+template <class DataType>
+template <typename VisitType>
+void BSTClass<DataType>::parallelForEach
+   (
+    VisitType visit,          // input: called with each item
+    BSTThreadPool &pool       // input: workers to run on
+   ) const
+{
+    vector<TraversalPiece> pieces;
+    BSTTaskGroup group;
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    int index;
+
+    splitPieces( rootNode, pieceDepth( pool ), pieces );
+
+    for( index = 0; index < int( pieces.size() ); index++ )
+    {
+        pool.submit( group, bind( 
+                  &BSTClass<DataType>::template forEachPieceHelper<VisitType>,
+                  this, &pieces[ index ], &visit ) );
+    }
+
+    pool.wait( group );
+}
+
+/**
+ * @brief Parallel reduce method
+ *
+ * @details Folds every item into one result, using all workers of pool
+ *          
+ * @pre assumes Initialized BSTClass object, tree is not changed
+ *      until the method returns
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Splits the top levels of the tree into pieces as parallelForEach
+ *      does; with keepOrder each piece folds into its own result and the
+ *      piece results are combined left to right, otherwise each worker
+ *      folds into one result of its own and the worker results are
+ *      combined at the end
+ * 
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] identity
+ *             starting value of every partial result
+ *
+ * @param [in] accumulate
+ *             called as accumulate( ResultType &, const DataType & ) to
+ *             fold one item into a partial result
+ *
+ * @param [in] combine
+ *             called as combine( ResultType &, const ResultType & ) to
+ *             fold a later partial result into an earlier one
+ *
+ * @param [in] keepOrder
+ *             true if results must be combined in key order, such as when
+ *             collecting items; false allows fewer, per worker results
+ *
+ * @param [in] pool
+ *             workers to run on
+ *
+ * @return Combined result, identity if tree is empty
+ *
+ * @note combine must be associative; it must also be commutative
+ *       unless keepOrder is set
+ */
+template <class DataType>
+template <typename ResultType, typename AccumulateType, typename CombineType>
+ResultType BSTClass<DataType>::parallelReduce
+   (
+    const ResultType &identity,     // input: starting value
+    AccumulateType accumulate,      // input: folds in one item
+    CombineType combine,            // input: folds in one partial result
+    bool keepOrder,                 // input: combine in key order
+    BSTThreadPool &pool             // input: workers to run on
+   ) const
+{
+    vector<TraversalPiece> pieces;
+    vector<ResultType> results;
+    ResultType finalResult( identity );
+    BSTTaskGroup group;
+    shared_lock<BSTSharedMutex> readGuard = readLock();
+    int index, resultIndex;
+
+    splitPieces( rootNode, pieceDepth( pool ), pieces );
+
+    if( pieces.empty() )
+    {
+        return finalResult;
+    }
+
+    if( keepOrder )
+    {
+        results.assign( pieces.size(), identity );
+    }
+
+    else
+    {
+        results.assign( pool.getThreadCount(), identity );
+    }
+
+    for( index = 0; index < int( pieces.size() ); index++ )
+    {
+        resultIndex = BSTThreadPool::NOT_A_WORKER;
+
+        if( keepOrder )
+        {
+            resultIndex = index;
+        }
+
+        pool.submit( group, bind( &BSTClass<DataType>::template 
+                          reducePieceHelper<ResultType, AccumulateType>,
+                          this, &pieces[ index ], &results[ 0 ], resultIndex,
+                          &accumulate, &pool ) );
+    }
+
+    pool.wait( group );
+
+    for( index = 0; index < int( results.size() ); index++ )
+    {
+        combine( finalResult, results[ index ] );
+    }
+
+    return finalResult;
+}
+
+/**
+ * @brief BSTInOrderIterator default constructor
+ *
+ * @details Constructs end iterator
+ *          
+ * @pre assumes Uninitialized BSTInOrderIterator object
+ *
+ * @post Iterator is at end of an empty tree
+ *
+ * @par Algorithm 
+ *      Initializes root to NULL with empty stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BSTInOrderIterator<DataType>::BSTInOrderIterator
+   (
+    // no parameters
+   )
+       : rootNode( NULL )
+{
+    // Initializer used
+}
+
+/**
+ * @brief BSTInOrderIterator root constructor
+ *
+ * @details Constructs iterator at smallest item of tree
+ *          
+ * @pre assumes Uninitialized BSTInOrderIterator object
+ *
+ * @post Iterator is at first item, or end if tree is empty
+ *
+ * @par Algorithm 
+ *      Calls pushLeftPath from root
+ * 
+ * @exception None
+ *
+ * @param [in] treeRoot
+ *             root of tree to iterate
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BSTInOrderIterator<DataType>::BSTInOrderIterator
+   (
+    const BSTNode<DataType> *treeRoot     // input: root of tree
+   )
+       : rootNode( treeRoot )
+{
+    pushLeftPath( treeRoot );
+}
+
+/**
+ * @brief Dereference operator
+ *
+ * @details Gives current item
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Returns data of node on top of stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType &BSTInOrderIterator<DataType>::operator *
+   (
+    // no parameters
+   ) const
+{
+    return nodeStack.back()->dataItem;
+}
+
+/**
+ * @brief Member access operator
+ *
+ * @details Gives address of current item
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Returns address of data of node on top of stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pointer to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType *BSTInOrderIterator<DataType>::operator ->
+   (
+    // no parameters
+   ) const
+{
+    return &nodeStack.back()->dataItem;
+}
+
+/**
+ * @brief Pre-increment operator
+ *
+ * @details Moves to in-order successor
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post Iterator is at next item or end
+ *
+ * @par Algorithm 
+ *      With a right child, descends to smallest item of right subtree;
+ *      otherwise pops until coming up from a left child
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to this iterator
+ *
+ * @note None
+ */
+template <class DataType>
+BSTInOrderIterator<DataType> &BSTInOrderIterator<DataType>::operator ++
    (
     // no parameters
-   ) const
+   )
 {
-    if( isEmpty() )
+    const BSTNode<DataType> *childPtr = nodeStack.back();
+
+    if( childPtr->right != NULL )
     {
-        cout << "Tree is empty" << endl;
+        pushLeftPath( childPtr->right );
     }
 
     else
     {
-        inOrderTraversalHelper( rootNode ); 
-        cout << endl;  
+        nodeStack.pop_back();
+
+        while( !nodeStack.empty() && nodeStack.back()->left != childPtr )
+        {
+            childPtr = nodeStack.back();
+            nodeStack.pop_back();
+        }
     }
+
+    return *this;
 }
 
 /**
- * @brief Postorder Traversal
+ * @brief Post-increment operator
  *
- * @details Outputs list in post-order
+ * @details Moves to in-order successor
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post Data in BST has been output to screen
+ * @post Iterator is at next item or end
  *
  * @par Algorithm 
- *      Calls postOrderTraversalHelper method
+ *      Copies iterator, then calls pre-increment
  * 
  * @exception None
  *
  * @param None
  *
- * @return None
+ * @return Copy of iterator before the move
+ *
+ * @note Copies the ancestor stack, prefer pre-increment
+ */
+template <class DataType>
+BSTInOrderIterator<DataType> BSTInOrderIterator<DataType>::operator ++
+   (
+    int     // input: postfix marker
+   )
+{
+    BSTInOrderIterator<DataType> oldIter( *this );
+
+    ++( *this );
+
+    return oldIter;
+}
+
+/**
+ * @brief Pre-decrement operator
+ *
+ * @details Moves to in-order predecessor
+ *          
+ * @pre assumes iterator is not at first item
+ *
+ * @post Iterator is at previous item
+ *
+ * @par Algorithm 
+ *      From end, descends to largest item; with a left child, descends
+ *      to largest item of left subtree; otherwise pops until coming up
+ *      from a right child
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to this iterator
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::postOrderTraversal
+BSTInOrderIterator<DataType> &BSTInOrderIterator<DataType>::operator --
    (
     // no parameters
-   ) const
+   )
 {
-    if( isEmpty() )
+    const BSTNode<DataType> *childPtr;
+
+    if( nodeStack.empty() )
+    {
+        pushRightPath( rootNode );
+
+        return *this;
+    }
+
+    childPtr = nodeStack.back();
+
+    if( childPtr->left != NULL )
     {
-        cout << "Tree is empty" << endl;
+        pushRightPath( childPtr->left );
     }
 
     else
     {
-        postOrderTraversalHelper( rootNode ); 
-        cout << endl; 
+        nodeStack.pop_back();
+
+        while( !nodeStack.empty() && nodeStack.back()->right != childPtr )
+        {
+            childPtr = nodeStack.back();
+            nodeStack.pop_back();
+        }
     }
+
+    return *this;
 }
 
 /**
- * @brief BSTClass copy method
+ * @brief Post-decrement operator
  *
- * @details Assigns BSTClass as copy of input
+ * @details Moves to in-order predecessor
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at first item
  *
- * @post BSTClass object is a copy
+ * @post Iterator is at previous item
+ *
+ * @par Algorithm 
+ *      Copies iterator, then calls pre-decrement
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Copy of iterator before the move
+ *
+ * @note Copies the ancestor stack, prefer pre-decrement
+ */
+template <class DataType>
+BSTInOrderIterator<DataType> BSTInOrderIterator<DataType>::operator --
+   (
+    int     // input: postfix marker
+   )
+{
+    BSTInOrderIterator<DataType> oldIter( *this );
+
+    --( *this );
+
+    return oldIter;
+}
+
+/**
+ * @brief Equality operator
+ *
+ * @details Compares iterator positions
+ *          
+ * @pre assumes both iterators belong to the same tree
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Compares current nodes, NULL at end
+ * 
+ * @exception None
+ *
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if same position
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTInOrderIterator<DataType>::operator ==
+   (
+    const BSTInOrderIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    if( nodeStack.empty() || other.nodeStack.empty() )
+    {
+        return nodeStack.empty() && other.nodeStack.empty();
+    }
+
+    return nodeStack.back() == other.nodeStack.back();
+}
+
+/**
+ * @brief Inequality operator
+ *
+ * @details Compares iterator positions
+ *          
+ * @pre assumes both iterators belong to the same tree
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Negates equality operator
+ * 
+ * @exception None
+ *
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if different position
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTInOrderIterator<DataType>::operator !=
+   (
+    const BSTInOrderIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    return !( *this == other );
+}
+
+/**
+ * @brief Push left path helper
+ *
+ * @details Descends to smallest item of subtree
+ *          
+ * @pre assumes stack holds the ancestors of workingPtr
+ *
+ * @post Smallest item of subtree is current
  *
  * @par Algorithm 
- *      Moves down through tree, creating new nodes and
- *      copying data from parameter tree
+ *      Pushes node and each left child in turn
  * 
  * @exception None
  *
  * @param [in] workingPtr
- *             BSTClass object to be copied into
+ *             root of subtree
  *
- * @param [in] sourcePtr
- *             BSTClass object to be copied from
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BSTInOrderIterator<DataType>::pushLeftPath
+   (
+    const BSTNode<DataType> *workingPtr     // input: subtree root
+   )
+{
+    while( workingPtr != NULL )
+    {
+        nodeStack.push_back( workingPtr );
+        workingPtr = workingPtr->left;
+    }
+}
+
+/**
+ * @brief Push right path helper
+ *
+ * @details Descends to largest item of subtree
+ *          
+ * @pre assumes stack holds the ancestors of workingPtr
+ *
+ * @post Largest item of subtree is current
+ *
+ * @par Algorithm 
+ *      Pushes node and each right child in turn
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree
  *
  * @return None
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::copyTree
+void BSTInOrderIterator<DataType>::pushRightPath
+   (
+    const BSTNode<DataType> *workingPtr     // input: subtree root
+   )
+{
+    while( workingPtr != NULL )
+    {
+        nodeStack.push_back( workingPtr );
+        workingPtr = workingPtr->right;
+    }
+}
+
+/**
+ * @brief BSTPreOrderIterator default constructor
+ *
+ * @details Constructs end iterator
+ *          
+ * @pre assumes Uninitialized BSTPreOrderIterator object
+ *
+ * @post Iterator is at end
+ *
+ * @par Algorithm 
+ *      Leaves stack empty
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BSTPreOrderIterator<DataType>::BSTPreOrderIterator
+   (
+    // no parameters
+   )
+{
+    // no action here
+}
+
+/**
+ * @brief BSTPreOrderIterator root constructor
+ *
+ * @details Constructs iterator at root of tree
+ *          
+ * @pre assumes Uninitialized BSTPreOrderIterator object
+ *
+ * @post Iterator is at root, or end if tree is empty
+ *
+ * @par Algorithm 
+ *      Pushes root if it exists
+ * 
+ * @exception None
+ *
+ * @param [in] treeRoot
+ *             root of tree to iterate
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BSTPreOrderIterator<DataType>::BSTPreOrderIterator
+   (
+    const BSTNode<DataType> *treeRoot     // input: root of tree
+   )
+{
+    if( treeRoot != NULL )
+    {
+        nodeStack.push_back( treeRoot );
+    }
+}
+
+/**
+ * @brief Dereference operator
+ *
+ * @details Gives current item
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Returns data of node on top of stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType &BSTPreOrderIterator<DataType>::operator *
+   (
+    // no parameters
+   ) const
+{
+    return nodeStack.back()->dataItem;
+}
+
+/**
+ * @brief Member access operator
+ *
+ * @details Gives address of current item
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Returns address of data of node on top of stack
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pointer to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType *BSTPreOrderIterator<DataType>::operator ->
+   (
+    // no parameters
+   ) const
+{
+    return &nodeStack.back()->dataItem;
+}
+
+/**
+ * @brief Pre-increment operator
+ *
+ * @details Moves to next item in pre-order
+ *          
+ * @pre assumes iterator is not at end
+ *
+ * @post Iterator is at next item or end
+ *
+ * @par Algorithm 
+ *      Pops current node, pushes its right then left child
+ *      so the left subtree is visited first
+ * 
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to this iterator
+ *
+ * @note None
+ */
+template <class DataType>
+BSTPreOrderIterator<DataType> &BSTPreOrderIterator<DataType>::operator ++
    (
-    BSTNode<DataType> *&workingPtr,        // input: tree to be assigned
-    const BSTNode<DataType> *sourcePtr     // input: tree to be copied
+    // no parameters
    )
 {
-    if( sourcePtr != NULL )
+    const BSTNode<DataType> *workingPtr = nodeStack.back();
+
+    nodeStack.pop_back();
+
+    if( workingPtr->right != NULL )
+    {
+        nodeStack.push_back( workingPtr->right );
+    }
+
+    if( workingPtr->left != NULL )
     {
-        workingPtr = new BSTNode<DataType>( sourcePtr->dataItem, NULL, NULL );
-        copyTree( workingPtr->left, sourcePtr->left );
-        copyTree( workingPtr->right, sourcePtr->right );
+        nodeStack.push_back( workingPtr->left );
     }
+
+    return *this;
 }
 
 /**
- * @brief Clear helper method
+ * @brief Post-increment operator
  *
- * @details Clears all data in object
+ * @details Moves to next item in pre-order
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post BSTClass object is empty
+ * @post Iterator is at next item or end
  *
  * @par Algorithm 
- *      Recursed through nodes, freeing memory
+ *      Copies iterator, then calls pre-increment
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             node to be cleared
+ * @param None
  *
- * @return None
+ * @return Copy of iterator before the move
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::clearHelper
+BSTPreOrderIterator<DataType> BSTPreOrderIterator<DataType>::operator ++
    (
-    BSTNode<DataType> *workingPtr     // input: node to be freed
+    int     // input: postfix marker
    )
 {
-    if( workingPtr != NULL )
-    {
-        clearHelper( workingPtr->left );
-        clearHelper( workingPtr->right );
+    BSTPreOrderIterator<DataType> oldIter( *this );
 
-        delete workingPtr;
-        workingPtr = NULL;
-    }
+    ++( *this );
+
+    return oldIter;
 }
 
 /**
- * @brief Insert helper method
+ * @brief Equality operator
  *
- * @details Inserts data in object
+ * @details Compares iterator positions
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes both iterators belong to the same tree
  *
- * @post newData is inserted into object
+ * @post None
  *
  * @par Algorithm 
- *      Analyzes data in nodes, then either recurses
- *      or inserts to left or right
+ *      Compares current nodes, NULL at end
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             node to be analyzed
- *
- * @param [in] newData
- *             Data to be inserted
+ * @param [in] other
+ *             iterator to compare with
  *
- * @return None
+ * @return Bool with true if same position
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::insertHelper
+bool BSTPreOrderIterator<DataType>::operator ==
    (
-    BSTNode<DataType> *&workingPtr,     // input: node to be checked
-    const DataType &newData             // input: data to be inserted
-   )
+    const BSTPreOrderIterator<DataType> &other     // input: other iterator
+   ) const
 {
-    if( workingPtr == NULL )
-    {
-        workingPtr = new BSTNode<DataType>( newData, NULL, NULL );
-        return;
-    }
-
-    else
+    if( nodeStack.empty() || other.nodeStack.empty() )
     {
-        if ( newData.compareTo(workingPtr->dataItem) == 0 )
-        {
-            return;
-        }
-
-        else if ( newData.compareTo(workingPtr->dataItem) < 0 )
-        {
-            if( workingPtr->left == NULL )
-            {
-                workingPtr->left = new BSTNode<DataType>( newData, NULL, NULL );
-                return;
-            }
-
-            else
-            {
-                insertHelper( workingPtr->left, newData );
-            }
-        }
-
-        else if ( newData.compareTo(workingPtr->dataItem) > 0 )
-        {
-            if( workingPtr->right == NULL )
-            {
-                workingPtr->right = new BSTNode<DataType>( newData, NULL, NULL );
-                return;
-            }
-
-            else
-            {
-                insertHelper( workingPtr->right, newData );
-            }
-        }
+        return nodeStack.empty() && other.nodeStack.empty();
     }
 
-    return;
+    return nodeStack.back() == other.nodeStack.back();
 }
 
 /**
- * @brief Find helper method
+ * @brief Inequality operator
  *
- * @details Finds data in object
+ * @details Compares iterator positions
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes both iterators belong to the same tree
  *
- * @post Know if data exists in BST
+ * @post None
  *
  * @par Algorithm 
- *      Recurses through tree, comparing data to input
+ *      Negates equality operator
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             Node to be checked
- *
- * @param [in] searchDataItem
- *             Data to be searched for
+ * @param [in] other
+ *             iterator to compare with
  *
- * @return Bool with true for success
+ * @return Bool with true if different position
  *
  * @note None
  */
 template <class DataType>
-bool BSTClass<DataType>::findHelper
+bool BSTPreOrderIterator<DataType>::operator !=
    (
-    BSTNode<DataType> *workingPtr,     // input: node to be checked
-    DataType &searchDataItem           // input: data to be searched for
+    const BSTPreOrderIterator<DataType> &other     // input: other iterator
    ) const
 {
-    if( workingPtr != NULL )
-    {
-        if( searchDataItem.compareTo(workingPtr->dataItem) == 0 )
-        {
-            return true;
-        }
-
-        else if( searchDataItem.compareTo(workingPtr->dataItem) < 0 )
-        {
-            return findHelper( workingPtr->left, searchDataItem );
-        }
-
-        else if( searchDataItem.compareTo(workingPtr->dataItem) > 0 )
-        {
-            return findHelper( workingPtr->right, searchDataItem );
-        }        
-    }
-
-    return false;
+    return !( *this == other );
 }
 
 /**
- * @brief Remove helper method
+ * @brief BSTPostOrderIterator default constructor
  *
- * @details Removes data from object
+ * @details Constructs end iterator
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes Uninitialized BSTPostOrderIterator object
  *
- * @post Data is removed from BST
+ * @post Iterator is at end
  *
  * @par Algorithm 
- *      Checks for number of children of node, then either removes data,
- *      recurses, or both, depending on 0, 1, or 2 children
+ *      Leaves stack empty
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             Node to be checked
- *
- * @param [in] removeDataItem
- *             Data to be removed
+ * @param None
  *
- * @return Bool with true for success
+ * @return None
  *
  * @note None
  */
 template <class DataType>
-bool BSTClass<DataType>::removeHelper
+BSTPostOrderIterator<DataType>::BSTPostOrderIterator
    (
-    BSTNode<DataType> *&workingPtr,    // input: node to be checked
-    const DataType &removeDataItem     // input: data to be removed
+    // no parameters
    )
 {
-    BSTNode<DataType>* tmp = NULL;
-    if( workingPtr->dataItem.compareTo(removeDataItem) == 0 )
-    {
-        if( workingPtr->left == NULL && workingPtr->right == NULL )
-        {
-            delete workingPtr;
-            workingPtr = NULL;
-            return true;
-        }
-
-        else if( workingPtr->left == NULL)
-        {
-            tmp = workingPtr;
-            workingPtr = workingPtr->right;
-            delete tmp;
-            tmp = NULL;
-            return true;
-        }
-
-        else if( workingPtr->right == NULL)
-        {
-            tmp = workingPtr;
-            workingPtr = workingPtr->left;
-            delete tmp;
-            tmp = NULL;
-            return true;
-        }
-
-        else
-        {
-            tmp = workingPtr->left;
-            while(tmp->right != NULL)
-            {
-                tmp = tmp->right;
-            }
-            workingPtr->dataItem = tmp->dataItem;
-            return removeHelper( workingPtr->left, tmp->dataItem );
-        }
-        
-        return false;
-    }
-
-    else if( workingPtr->dataItem.compareTo(removeDataItem) > 0 )
-    {
-        return removeHelper( workingPtr->left, removeDataItem );
-    }
-
-    else
-    {
-        return removeHelper( workingPtr->right, removeDataItem );
-    }
+    // no action here
 }
 
 /**
- * @brief Preorder Traversal helper
+ * @brief BSTPostOrderIterator root constructor
  *
- * @details Outputs list in pre-order
+ * @details Constructs iterator at first item in post-order
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes Uninitialized BSTPostOrderIterator object
  *
- * @post Data in BST has been output to screen
+ * @post Iterator is at first item, or end if tree is empty
  *
  * @par Algorithm 
- *      Traverses tree recursively in preorder
+ *      Calls pushFirstPath from root
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             node to be output and recursed on
+ * @param [in] treeRoot
+ *             root of tree to iterate
  *
  * @return None
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::preOrderTraversalHelper
+BSTPostOrderIterator<DataType>::BSTPostOrderIterator
    (
-    BSTNode<DataType> *workingPtr     // input: node to be output
-   ) const
+    const BSTNode<DataType> *treeRoot     // input: root of tree
+   )
 {
-    char string[ STD_STR_LEN ];
-    if( workingPtr != NULL )
-    {
-        workingPtr->dataItem.toString(string);
-        cout << string << endl;
-        preOrderTraversalHelper( workingPtr->left );
-        preOrderTraversalHelper( workingPtr->right );
-    }
+    pushFirstPath( treeRoot );
 }
 
 /**
- * @brief Inorder Traversal helper
+ * @brief Dereference operator
  *
- * @details Outputs list in order
+ * @details Gives current item
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post Data in BST has been output to screen
+ * @post None
  *
  * @par Algorithm 
- *      Traverses tree recursively in order
+ *      Returns data of node on top of stack
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             node to be output and recursed on
+ * @param None
  *
- * @return None
+ * @return Reference to current item
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::inOrderTraversalHelper
+const DataType &BSTPostOrderIterator<DataType>::operator *
    (
-    BSTNode<DataType> *workingPtr     // input: node to be output
+    // no parameters
    ) const
 {
-    char string[ STD_STR_LEN ];
-    if( workingPtr != NULL )
-    {
-        workingPtr->dataItem.toString(string);
-        inOrderTraversalHelper( workingPtr->left );
-        cout << string << endl;
-        inOrderTraversalHelper( workingPtr->right );
-    }  
+    return nodeStack.back()->dataItem;
 }
 
 /**
- * @brief Postorder Traversal helper
+ * @brief Member access operator
  *
- * @details Outputs list in post-order
+ * @details Gives address of current item
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post Data in BST has been output to screen
+ * @post None
  *
  * @par Algorithm 
- *      Traverses tree recursively in postorder
+ *      Returns address of data of node on top of stack
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             node to be output and recursed on
+ * @param None
  *
- * @return None
+ * @return Pointer to current item
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::postOrderTraversalHelper
+const DataType *BSTPostOrderIterator<DataType>::operator ->
    (
-    BSTNode<DataType> *workingPtr     // input: node to be output
+    // no parameters
    ) const
 {
-    char string[ STD_STR_LEN ];
-    if( workingPtr != NULL )
-    {
-        workingPtr->dataItem.toString(string);
-        postOrderTraversalHelper( workingPtr->left );
-        postOrderTraversalHelper( workingPtr->right );
-        cout << string << endl;
-    }
+    return &nodeStack.back()->dataItem;
 }
 
 /**
- * @brief get height of node
+ * @brief Pre-increment operator
  *
- * @details returns height of node from lowest leaf
+ * @details Moves to next item in post-order
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post Height of node has been returned
+ * @post Iterator is at next item or end
  *
  * @par Algorithm 
- *      Compares left and right heights and recursively adds
+ *      Pops current node; if it was a left child and its parent has
+ *      a right subtree, descends to the first item of that subtree,
+ *      otherwise the parent is next
  * 
  * @exception None
  *
- * @param [in] workintPtr
- *             node to find height of
+ * @param None
  *
- * @return None
+ * @return Reference to this iterator
  *
  * @note None
  */
 template <class DataType>
-int BSTClass<DataType>::getHeight
+BSTPostOrderIterator<DataType> &BSTPostOrderIterator<DataType>::operator ++
    (
-    BSTNode<DataType> *workingPtr     // input: node to find height of
+    // no parameters
    )
 {
-    int leftH, rightH;
-
-    if( workingPtr == NULL )
-    {
-        return 0;
-    }
+    const BSTNode<DataType> *childPtr = nodeStack.back();
 
-    leftH = getHeight( workingPtr->left );
-    rightH = getHeight( workingPtr->right );
+    nodeStack.pop_back();
 
-    if( rightH > leftH )
+    if( !nodeStack.empty() && nodeStack.back()->left == childPtr )
     {
-        return rightH + 1;
+        pushFirstPath( nodeStack.back()->right );
     }
 
-    else
-    {
-        return leftH + 1;
-    }
+    return *this;
 }
 
 /**
- * @brief show BST structure helper
+ * @brief Post-increment operator
  *
- * @details Displays structure of BST
+ * @details Moves to next item in post-order
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes iterator is not at end
  *
- * @post Data in BST has been output to screen
+ * @post Iterator is at next item or end
  *
  * @par Algorithm 
- *      if node is in correct row, displays spaces before data
- *      based on row #, then outputs node data
+ *      Copies iterator, then calls pre-increment
  * 
  * @exception None
  *
- * @param [in] workingPtr
- *             pointer to node to be tested and displayed
- *
- * @param [in] callerHeight
- *             height of row being printed
- *
- * @param [in] thisHeight
- *             height of workingPtr node
- *
- * @param [in] leftMost
- *             bool denoting if farthest left item of row
+ * @param None
  *
- * @return None
+ * @return Copy of iterator before the move
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::structureHelper
+BSTPostOrderIterator<DataType> BSTPostOrderIterator<DataType>::operator ++
    (
-    BSTNode<DataType> *workingPtr,     // input: node to print
-    int callerHeight,                  // input: height of row to pring
-    int thisHeight,                    // input: height of current node
-    bool leftMost                      // input: node left most of row
+    int     // input: postfix marker
    )
 {
-    char string[ STD_STR_LEN ];
-    int numStartSpaces = pow( 2, thisHeight ) - 1;
-    int numSepSpaces = pow( 2, thisHeight + 1 ) - 3;
-    int index = 0;
-
-
-    if( callerHeight == thisHeight )
-    {
-        if( leftMost == true )
-        { 
-            for( ; index < numStartSpaces; index++ )
-            {
-                cout << ' ';
-            }
-        }
-
-        else
-        {
-            for( ; index < numSepSpaces; index++ )
-            {
-                cout << ' ';
-            }
-        }
+    BSTPostOrderIterator<DataType> oldIter( *this );
 
-        if( workingPtr != NULL )
-        {
-            workingPtr->dataItem.toString( string );
-            cout << string;
-        }
+    ++( *this );
 
-        else
-        {
-            cout << EMPTY_STR;
-        }
-    }
+    return oldIter;
+}
 
-    if( thisHeight > 1 )
+/**
+ * @brief Equality operator
+ *
+ * @details Compares iterator positions
+ *          
+ * @pre assumes both iterators belong to the same tree
+ *
+ * @post None
+ *
+ * @par Algorithm 
+ *      Compares current nodes, NULL at end
+ * 
+ * @exception None
+ *
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if same position
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTPostOrderIterator<DataType>::operator ==
+   (
+    const BSTPostOrderIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    if( nodeStack.empty() || other.nodeStack.empty() )
     {
-        if( workingPtr != NULL )
-        {
-            structureHelper( workingPtr->left, callerHeight, thisHeight-1, leftMost );
-            structureHelper( workingPtr->right, callerHeight, thisHeight-1, false );
-        }  
-
-        else
-        {
-            structureHelper( NULL, callerHeight, thisHeight-1, leftMost );
-            structureHelper( NULL, callerHeight, thisHeight-1, false );            
-        }
+        return nodeStack.empty() && other.nodeStack.empty();
     }
 
+    return nodeStack.back() == other.nodeStack.back();
 }
 
 /**
- * @brief show BST structure
+ * @brief Inequality operator
  *
- * @details Displays structure of BST
+ * @details Compares iterator positions
  *          
- * @pre assumes Initialized BSTClass object
+ * @pre assumes both iterators belong to the same tree
  *
- * @post Data in BST has been output to screen
+ * @post None
  *
  * @par Algorithm 
- *      Calls structureHelper method height times
+ *      Negates equality operator
  * 
  * @exception None
  *
- * @param [in] ID
- *             char to denote ID of tree being displayed
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if different position
+ *
+ * @note None
+ */
+template <class DataType>
+bool BSTPostOrderIterator<DataType>::operator !=
+   (
+    const BSTPostOrderIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    return !( *this == other );
+}
+
+/**
+ * @brief Push first path helper
+ *
+ * @details Descends to first item of subtree in post-order
+ *          
+ * @pre assumes stack holds the ancestors of workingPtr
+ *
+ * @post First post-order item of subtree is current
+ *
+ * @par Algorithm 
+ *      Pushes nodes going left when possible, else right,
+ *      until a leaf is pushed
+ * 
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             root of subtree, may be NULL
  *
  * @return None
  *
  * @note None
  */
 template <class DataType>
-void BSTClass<DataType>::showBSTStructure
+void BSTPostOrderIterator<DataType>::pushFirstPath
    (
-    char ID     // input: id of tree to show
+    const BSTNode<DataType> *workingPtr     // input: subtree root
    )
 {
-    int height = getHeight( rootNode );
-    int max = height;
+    while( workingPtr != NULL )
+    {
+        nodeStack.push_back( workingPtr );
 
-    cout << "BST ID " << ID << ":" << endl;
+        if( workingPtr->left != NULL )
+        {
+            workingPtr = workingPtr->left;
+        }
 
-    for(  ; height > 0; height-- )
-    {
-        structureHelper( rootNode, height, max, true );
-        cout << endl;
+        else
+        {
+            workingPtr = workingPtr->right;
+        }
     }
-
-    cout << endl;
 }
 
-
 #endif  // define BST_CLASS_CPP
\ No newline at end of file
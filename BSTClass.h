@@ -26,9 +26,24 @@
 #ifndef BST_CLASS_H
 #define BST_CLASS_H
 
+// compile with -DBST_STATS for trees to count the compares of each find,
+// insert and remove and the nodes they allocate and free, see getStats
+
 // Header files ///////////////////////////////////////////////////////////////
 
+#include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+#include "BSTNodePool.h"
+#include "BSTReclaimer.h"
+#include "BSTSharedMutex.h"
+#include "BSTThreadPool.h"
+#include "FrozenBSTClass.h"
 
 using namespace std;
 
@@ -49,6 +64,154 @@ class BSTNode
 
        BSTNode<DataType> *left;
        BSTNode<DataType> *right;
+
+       int height;
+
+       // nodes in the subtree rooted here, this one included
+       int size;
+
+       // links and trees holding this node, only PERSISTENT trees share
+       atomic<int> refCount;
+   };
+
+struct BSTStats
+   {
+    int nodeCount;
+    int height;
+
+    // nodes at each depth, root at depth 0
+    vector<int> depthCounts;
+
+    // compares made by the average successful find
+    double averagePathLength;
+
+    // false unless compiled with BST_STATS, all below are then zero
+    bool countsKept;
+
+    // since construction or last resetStats
+    long long findCount;
+    long long insertCount;
+    long long removeCount;
+
+    double averageFindCompares;
+    double averageInsertCompares;
+    double averageRemoveCompares;
+
+    long long maxFindCompares;
+    long long maxInsertCompares;
+    long long maxRemoveCompares;
+
+    long long nodesAllocated;
+    long long nodesFreed;
+   };
+
+template <typename DataType>
+class BSTClass;
+
+template <typename DataType>
+class BSTInOrderIterator
+   {
+    public:
+
+       // standard iterator types
+       typedef bidirectional_iterator_tag iterator_category;
+       typedef DataType value_type;
+       typedef ptrdiff_t difference_type;
+       typedef const DataType *pointer;
+       typedef const DataType &reference;
+
+       BSTInOrderIterator();
+
+       reference operator * () const;
+       pointer operator -> () const;
+       BSTInOrderIterator &operator ++ ();
+       BSTInOrderIterator operator ++ ( int );
+       BSTInOrderIterator &operator -- ();
+       BSTInOrderIterator operator -- ( int );
+
+       bool operator == ( const BSTInOrderIterator<DataType> &other ) const;
+       bool operator != ( const BSTInOrderIterator<DataType> &other ) const;
+
+    private:
+
+       friend class BSTClass<DataType>;
+
+       BSTInOrderIterator( const BSTNode<DataType> *treeRoot );
+
+       void pushLeftPath( const BSTNode<DataType> *workingPtr );
+
+       void pushRightPath( const BSTNode<DataType> *workingPtr );
+
+       const BSTNode<DataType> *rootNode;
+
+       // ancestors of the current node, current node on top
+       vector<const BSTNode<DataType> *> nodeStack;
+   };
+
+template <typename DataType>
+class BSTPreOrderIterator
+   {
+    public:
+
+       // standard iterator types
+       typedef forward_iterator_tag iterator_category;
+       typedef DataType value_type;
+       typedef ptrdiff_t difference_type;
+       typedef const DataType *pointer;
+       typedef const DataType &reference;
+
+       BSTPreOrderIterator();
+
+       reference operator * () const;
+       pointer operator -> () const;
+       BSTPreOrderIterator &operator ++ ();
+       BSTPreOrderIterator operator ++ ( int );
+
+       bool operator == ( const BSTPreOrderIterator<DataType> &other ) const;
+       bool operator != ( const BSTPreOrderIterator<DataType> &other ) const;
+
+    private:
+
+       friend class BSTClass<DataType>;
+
+       BSTPreOrderIterator( const BSTNode<DataType> *treeRoot );
+
+       // nodes still to visit, current node on top
+       vector<const BSTNode<DataType> *> nodeStack;
+   };
+
+template <typename DataType>
+class BSTPostOrderIterator
+   {
+    public:
+
+       // standard iterator types
+       typedef forward_iterator_tag iterator_category;
+       typedef DataType value_type;
+       typedef ptrdiff_t difference_type;
+       typedef const DataType *pointer;
+       typedef const DataType &reference;
+
+       BSTPostOrderIterator();
+
+       reference operator * () const;
+       pointer operator -> () const;
+       BSTPostOrderIterator &operator ++ ();
+       BSTPostOrderIterator operator ++ ( int );
+
+       bool operator == ( const BSTPostOrderIterator<DataType> &other ) const;
+       bool operator != ( const BSTPostOrderIterator<DataType> &other ) const;
+
+    private:
+
+       friend class BSTClass<DataType>;
+
+       BSTPostOrderIterator( const BSTNode<DataType> *treeRoot );
+
+       void pushFirstPath( const BSTNode<DataType> *workingPtr );
+
+       // ancestors of the current node, current node on top
+       vector<const BSTNode<DataType> *> nodeStack;
    };
 
 template <typename DataType>
@@ -63,57 +226,345 @@ class BSTClass
        static const int INITIALIZE = 101;
        static const int AT_BOTTOM = 102;
        static const int GET_RESULT = 103;
+       static const int OUTPUT_BUFFER_SIZE = 65536;
+       static const int MAX_STRUCTURE_DEPTH = 20;
+
+       // tree option flags
+       static const int UNBALANCED = 0x00;
+       static const int AVL_BALANCE = 0x01;
+       static const int SLAB_ALLOC = 0x02;
+       static const int THREAD_SAFE = 0x04;
+       static const int PERSISTENT = 0x08;
+       static const int DEFERRED_FREE = 0x10;
+
+       // iterator types, items are read only to keep the tree ordered
+       typedef BSTInOrderIterator<DataType> const_iterator;
+       typedef BSTInOrderIterator<DataType> iterator;
+       typedef BSTPreOrderIterator<DataType> pre_order_iterator;
+       typedef BSTPostOrderIterator<DataType> post_order_iterator;
 
        // constructor
        BSTClass();
+       explicit BSTClass( int treeOptions );
        BSTClass( const BSTClass<DataType> &copied );
+       BSTClass( const BSTClass<DataType> &copied, BSTThreadPool &pool );
+       BSTClass( BSTClass<DataType> &&moved ) noexcept;
 
        // destructor
        ~BSTClass();
 
        // assignment operator
        const BSTClass &operator = (const BSTClass<DataType> &rhData );
+       const BSTClass &operator = ( BSTClass<DataType> &&rhData ) noexcept;
 
        // modifiers
+       void swap( BSTClass<DataType> &other ) noexcept;
        void clear();
        void insert( const DataType &newData );
        bool find( DataType &searchDataItem ) const;
+       int findBatch( const DataType *searchItems, bool *foundFlags,
+                                                    int itemCount ) const;
        bool remove( const DataType &dataItem );
+       void buildFromSorted( const DataType *items, int itemCount );
+       void buildFromUnsorted( const DataType *items, int itemCount,
+                                                           int numThreads );
+       void buildFromStream( istream &inStream,
+                          bool ( *readItem )( istream &, DataType & ) );
+       BSTClass<DataType> split( const DataType &splitItem );
+       bool join( BSTClass<DataType> &highTree );
+       void merge( BSTClass<DataType> &other );
+
+       // set algebra, other is only read
+       void unionWith( const BSTClass<DataType> &other );
+       void unionWith( const BSTClass<DataType> &other, BSTThreadPool &pool );
+       void intersectWith( const BSTClass<DataType> &other );
+       void intersectWith( const BSTClass<DataType> &other, 
+                                                     BSTThreadPool &pool );
+       void differenceWith( const BSTClass<DataType> &other );
+       void differenceWith( const BSTClass<DataType> &other, 
+                                                     BSTThreadPool &pool );
 
        // accessors
        bool isEmpty() const;
+       int size() const;
+       int height() const;
+       int rank( const DataType &rankDataItem ) const;
+       bool select( int position, DataType &foundItem ) const;
        void preOrderTraversal() const; 
        void inOrderTraversal() const;  
        void postOrderTraversal() const;
-       void showBSTStructure( char ID );
+       void preOrderTraversal( ostream &outStream ) const;
+       void inOrderTraversal( ostream &outStream ) const;
+       void postOrderTraversal( ostream &outStream ) const;
+       void showBSTStructure( char ID ) const;
+       void showBSTStructure( ostream &outStream, char ID, 
+                                                   int maxDepth ) const;
+       FrozenBSTClass<DataType> freeze() const;
+       BSTClass<DataType> snapshot() const;
+
+       long long getCompareCount() const;
+       void resetCompareCount();
+
+       BSTStats getStats() const;
+       void resetStats();
+
+       // iterators
+       const_iterator begin() const;
+       const_iterator end() const;
+       const_iterator lowerBound( const DataType &lowItem ) const;
+       const_iterator upperBound( const DataType &highItem ) const;
+       pre_order_iterator preOrderBegin() const;
+       pre_order_iterator preOrderEnd() const;
+       post_order_iterator postOrderBegin() const;
+       post_order_iterator postOrderEnd() const;
+
+       // range operations, items from lowItem to highItem inclusive
+       void rangeTraversal( ostream &outStream, const DataType &lowItem,
+                                        const DataType &highItem ) const;
+
+       template <typename VisitType>
+       void forEachInRange( const DataType &lowItem, 
+                        const DataType &highItem, VisitType visit ) const;
+
+       // parallel whole tree operations
+       void parallelClear( BSTThreadPool &pool );
+
+       template <typename VisitType>
+       void parallelForEach( VisitType visit, BSTThreadPool &pool ) const;
+
+       template <typename ResultType, typename AccumulateType, 
+                                                     typename CombineType>
+       ResultType parallelReduce( const ResultType &identity, 
+                                  AccumulateType accumulate, 
+                                  CombineType combine, bool keepOrder,
+                                  BSTThreadPool &pool ) const;
  
     private:
 
+       // one unit of parallel work, a whole subtree or a single node
+       struct TraversalPiece
+          {
+           const BSTNode<DataType> *node;
+           bool wholeSubtree;
+          };
+
+       // one subtree to be copied, and where the copy is linked
+       struct CopyPiece
+          {
+           BSTNode<DataType> **destLink;
+           const BSTNode<DataType> *source;
+           BSTNodePool< BSTNode<DataType> > *piecePool;
+          };
+
+       // one node of an in order walk, and whether this tree may move it
+       struct FlattenStep
+          {
+           BSTNode<DataType> *node;
+           bool reusable;
+          };
+
+       // one set operation, shared by all of its tasks
+       struct SetOperation
+          {
+           int kind;
+           const BSTClass<DataType> *source;
+           BSTThreadPool *pool;
+          };
+
+       // costs counted with BST_STATS, atomic since finds and parallel
+       // tasks update them together
+       struct StatCounters
+          {
+           StatCounters();
+
+           atomic<long long> operations[ 3 ];
+           atomic<long long> compares[ 3 ];
+           atomic<long long> maxCompares[ 3 ];
+           atomic<long long> nodesAllocated;
+           atomic<long long> nodesFreed;
+
+           // shared nodes freed later by the reclaimer, which may
+           // outlive the tree
+           shared_ptr< atomic<long long> > deferredFreed;
+          };
+
+       // nodes dropped by a deferred clear, freed by the reclaimer
+       struct ReclaimGraph
+          {
+           vector<BSTNode<DataType> *> nodeStack;
+           BSTNodePool< BSTNode<DataType> > *graphPool;
+           bool shared;
+
+           // BST_STATS count of shared nodes freed, or NULL
+           shared_ptr< atomic<long long> > freedCount;
+          };
+
+       unique_lock<BSTSharedMutex> writeLock() const;
+
+       shared_lock<BSTSharedMutex> readLock() const;
+
+       void clearTree();
+
+       bool deferTree();
+
+       static bool reclaimStep( ReclaimGraph *graph, int nodeBudget );
+
+       static BSTNode<DataType> *allocateNode( const DataType &nodeData,
+                                BSTNodePool< BSTNode<DataType> > *fromPool );
+
+       BSTNode<DataType> *newNode( const DataType &nodeData );
+
+       void freeNode( BSTNode<DataType> *workingPtr );
+
+       void releaseNode( BSTNode<DataType> *workingPtr );
+
+       void ownNode( BSTNode<DataType> *&workingPtr );
+
+       void ownPath( vector<BSTNode<DataType> **> &path, 
+                                          BSTNode<DataType> **&linkPtr );
+
+       void adoptTree( BSTNode<DataType> *sourcePtr );
+
        void copyTree( BSTNode<DataType> *&workingPtr, 
-                                       const BSTNode<DataType> *sourcePtr );
+                           const BSTNode<DataType> *sourcePtr,
+                           BSTNodePool< BSTNode<DataType> > *fromPool );
+
+       void parallelCopyTree( const BSTNode<DataType> *sourcePtr, 
+                                                     BSTThreadPool &pool );
+
+       void splitCopy( BSTNode<DataType> *&workingPtr, 
+                           const BSTNode<DataType> *sourcePtr, int depth,
+                                           vector<CopyPiece> &pieces );
+
+       void copyPieceHelper( CopyPiece *piece );
 
        void clearHelper( BSTNode<DataType> *workingPtr );
 
+       void splitClear( BSTNode<DataType> *workingPtr, int depth,
+                                   vector<BSTNode<DataType> *> &subtrees );
+
+       void clearPieceHelper( BSTNode<DataType> *workingPtr );
+
+       BSTNode<DataType> *buildHelper( const DataType *items, 
+                                                      int low, int high );
+
+       void parallelBuildHelper( BSTNode<DataType> *&workingPtr,
+                                  const DataType *items, int low, int high,
+                                  int numThreads, BSTNode<DataType> *nodeRun );
+
        void insertHelper( BSTNode<DataType> *&workingPtr, 
                                                   const DataType &newData );
 
        bool findHelper( BSTNode<DataType> *workingPtr, 
                                      DataType &searchDataItem ) const;
 
+       void countCompares( long long compares ) const;
+
+       void recordCompares( int kind, long long compares ) const;
+
+       void countNodes( long long allocated, long long freed ) const;
+
+       void exchangeStats( BSTClass<DataType> &other ) noexcept;
+
+       const_iterator boundHelper( const DataType &boundItem, 
+                                               bool includeEqual ) const;
+
        bool removeHelper( BSTNode<DataType> *&workingPtr, 
                                            const DataType &removeDataItem );
 
-       void preOrderTraversalHelper( BSTNode<DataType> *workingPtr) const;
+       BSTNode<DataType> *joinHelper( BSTNode<DataType> *lowPtr, 
+                                      BSTNode<DataType> *pivotPtr,
+                                      BSTNode<DataType> *highPtr );
+
+       BSTNode<DataType> *joinTrees( BSTNode<DataType> *lowPtr, 
+                                              BSTNode<DataType> *highPtr );
+
+       BSTNode<DataType> *detachFirst( BSTNode<DataType> *&workingPtr );
+
+       BSTNode<DataType> *splitHelper( BSTNode<DataType> *workingPtr,
+                                       const DataType &splitItem,
+                                       BSTNode<DataType> *&lowPtr,
+                                       BSTNode<DataType> *&highPtr,
+                                       long long &compares );
+
+       BSTNode<DataType> *takeTree( BSTClass<DataType> &source );
+
+       void setOperation( const BSTClass<DataType> &other, int kind,
+                                                   BSTThreadPool *pool );
+
+       void setHelper( BSTNode<DataType> *&resultPtr, 
+                       BSTNode<DataType> *workingPtr,
+                       const BSTNode<DataType> *otherPtr,
+                       const SetOperation *operation, int depth,
+                       long long *compares );
+
+       BSTNode<DataType> *copySubtree( const BSTNode<DataType> *sourcePtr,
+                                       const BSTClass<DataType> &source );
+
+       void flattenTree( BSTNode<DataType> *workingPtr, bool reuseNodes,
+                         vector<BSTNode<DataType> *> &nodeList,
+                         vector<BSTNode<DataType> *> &sharedList );
+
+       BSTNode<DataType> *relinkHelper( BSTNode<DataType> **nodeList, 
+                                                      int low, int high );
+
+       template <typename IteratorType>
+       void traversalHelper( ostream &outStream, IteratorType iter, 
+                                               IteratorType endIter ) const;
 
-       void inOrderTraversalHelper( BSTNode<DataType> *workingPtr) const;
+       static int pieceDepth( const BSTThreadPool &pool );
 
-       void postOrderTraversalHelper( BSTNode<DataType> *workingPtr) const;
+       void splitPieces( const BSTNode<DataType> *workingPtr, int depth,
+                                   vector<TraversalPiece> &pieces ) const;
 
-       int getHeight( BSTNode<DataType> *workingPtr );
+       template <typename VisitType>
+       void forEachPieceHelper( const TraversalPiece *piece, 
+                                                 VisitType *visit ) const;
 
-       void structureHelper( BSTNode<DataType> *workingPtr, int callerHeight, int thisHeight, bool leftMost );
+       template <typename ResultType, typename AccumulateType>
+       void reducePieceHelper( const TraversalPiece *piece, 
+                               ResultType *results, int resultIndex,
+                               AccumulateType *accumulate, 
+                               const BSTThreadPool *pool ) const;
+
+       void structureHelper( ostream &outStream, 
+                        const vector<const BSTNode<DataType> *> &rowSlots,
+                        int rowHeight, bool elideBelow, 
+                        vector<char> &outBuffer ) const;
+
+       int nodeHeight( const BSTNode<DataType> *workingPtr ) const;
+
+       int nodeSize( const BSTNode<DataType> *workingPtr ) const;
+
+       void updateNode( BSTNode<DataType> *workingPtr );
+
+       void rotateLeft( BSTNode<DataType> *&workingPtr );
+
+       void rotateRight( BSTNode<DataType> *&workingPtr );
+
+       void rebalance( BSTNode<DataType> *&workingPtr );
+
+       void retracePath( vector<BSTNode<DataType> **> &path, 
+                                                          int sizeChange );
 
        BSTNode<DataType> *rootNode;    
+
+       int options;
+
+       BSTNodePool< BSTNode<DataType> > *nodePool;
+
+       mutable long long compareCount;
+
+       // compares made by finds running under a shared lock
+       mutable atomic<long long> sharedCompareCount;
+
+       BSTSharedMutex *treeLock;
+
+       vector<BSTNode<DataType> **> pathStack;
+
+#ifdef BST_STATS
+       mutable StatCounters statCounters;
+#endif
    };
 
 #endif	// define BST_CLASS_H
@@ -0,0 +1,579 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTEpochManager.cpp
+ *
+ * @brief Implementation file for BSTEpochManager
+ *
+ * @details Implements all member methods of the BSTEpochManager
+ *          and BSTEpochGuard
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires BSTEpochManager.h
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_EPOCH_MANAGER_CPP
+#define BST_EPOCH_MANAGER_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "BSTEpochManager.h"
+
+using namespace std;
+
+// managers still alive, so exiting threads can hand back their records
+static mutex registryLock;
+static map<unsigned long, BSTEpochManager *> liveManagers;
+static unsigned long nextSerialNumber = 1;
+
+/**
+ * @brief Per thread cache of claimed records
+ *
+ * @details Maps manager serial numbers to the record this thread claimed,
+ *          handing every record back when the thread exits
+ */
+struct EpochThreadCache
+   {
+    vector< pair<unsigned long, int> > entries;
+
+    ~EpochThreadCache()
+       {
+        size_t index;
+        map<unsigned long, BSTEpochManager *>::iterator found;
+        lock_guard<mutex> registryGuard( registryLock );
+
+        for( index = 0; index < entries.size(); index++ )
+           {
+            found = liveManagers.find( entries[ index ].first );
+
+            if( found != liveManagers.end() )
+               {
+                found->second->releaseRecord( entries[ index ].second );
+               }
+           }
+       }
+   };
+
+static thread_local EpochThreadCache threadCache;
+
+/**
+ * @brief BSTEpochManager default constructor
+ *
+ * @details Constructs manager with no thread inside an epoch
+ *
+ * @pre assumes Uninitialized BSTEpochManager object
+ *
+ * @post Every record is free, manager is registered
+ *
+ * @par Algorithm
+ *      Initializes records, then takes a serial number under the
+ *      registry lock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Serial numbers are never reused, so a stale cache entry of an
+ *       exited thread can not match a later manager at the same address
+ */
+BSTEpochManager::BSTEpochManager
+   (
+    // no parameters
+   )
+       : globalEpoch( EPOCH_COUNT )
+{
+    int index, bucket;
+
+    for( index = 0; index < MAX_THREADS; index++ )
+    {
+        records[ index ].claimed = false;
+        records[ index ].state = 0;
+        records[ index ].nestDepth = 0;
+        records[ index ].retireCount = 0;
+
+        for( bucket = 0; bucket < EPOCH_COUNT; bucket++ )
+        {
+            records[ index ].limboEpoch[ bucket ] = 0;
+        }
+    }
+
+    lock_guard<mutex> registryGuard( registryLock );
+
+    serialNumber = nextSerialNumber++;
+
+    liveManagers[ serialNumber ] = this;
+}
+
+/**
+ * @brief BSTEpochManager destructor
+ *
+ * @details Frees every retired object and destructs manager
+ *
+ * @pre assumes no thread is inside an epoch of this manager
+ *
+ * @post All retired objects are destroyed
+ *
+ * @par Algorithm
+ *      Unregisters under the registry lock, then empties every
+ *      limbo list
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTEpochManager::~BSTEpochManager
+   (
+    // no parameters
+   )
+{
+    int index, bucket;
+
+       {
+        lock_guard<mutex> registryGuard( registryLock );
+
+        liveManagers.erase( serialNumber );
+       }
+
+    for( index = 0; index < MAX_THREADS; index++ )
+    {
+        for( bucket = 0; bucket < EPOCH_COUNT; bucket++ )
+        {
+            freeBucket( records[ index ], bucket );
+        }
+    }
+}
+
+/**
+ * @brief Enter method
+ *
+ * @details Marks calling thread as reading shared objects
+ *
+ * @pre assumes Initialized BSTEpochManager object
+ *
+ * @post No object retired from now on is freed before exit is called
+ *
+ * @par Algorithm
+ *      Announces the global epoch as this thread's epoch, repeating
+ *      if the epoch moved meanwhile; then frees own retired objects
+ *      that have become safe
+ *
+ * @exception length_error if more than MAX_THREADS threads use
+ *            the manager at once
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Calls may nest, only the outermost pair has any effect
+ */
+void BSTEpochManager::enter
+   (
+    // no parameters
+   )
+{
+    ThreadRecord &record = getRecord();
+    unsigned long epoch;
+
+    record.nestDepth++;
+
+    if( record.nestDepth > 1 )
+    {
+        return;
+    }
+
+    do
+    {
+        epoch = globalEpoch.load();
+
+        record.state.store( 2 * epoch + 1 );
+    }
+    while( globalEpoch.load() != epoch );
+
+    freeExpired( record );
+}
+
+/**
+ * @brief Exit method
+ *
+ * @details Marks calling thread as no longer reading shared objects
+ *
+ * @pre assumes enter was called by this thread
+ *
+ * @post Thread no longer holds back reclamation
+ *
+ * @par Algorithm
+ *      Clears the inside flag of the outermost call
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTEpochManager::exit
+   (
+    // no parameters
+   )
+{
+    ThreadRecord &record = getRecord();
+
+    record.nestDepth--;
+
+    if( record.nestDepth == 0 )
+    {
+        record.state.store( record.state.load( memory_order_relaxed ) - 1,
+                                                    memory_order_release );
+    }
+}
+
+/**
+ * @brief Retire method
+ *
+ * @details Schedules an unlinked object to be destroyed once
+ *          no thread can still hold it
+ *
+ * @pre assumes object is no longer reachable by new readers
+ *
+ * @post Object is destroyed no earlier than two epochs later
+ *
+ * @par Algorithm
+ *      Files the object under the current epoch; a bucket still holding
+ *      objects from three epochs back is emptied first; every
+ *      RETIRE_BATCH retirements tries to advance the global epoch
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] objectPtr
+ *             object being retired
+ *
+ * @param [in] destroy
+ *             function destroying the object
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTEpochManager::retire
+   (
+    void *objectPtr,                  // input: object being retired
+    void ( *destroy )( void * )       // input: destroys object
+   )
+{
+    ThreadRecord &record = getRecord();
+    RetiredObject retired;
+    unsigned long epoch = globalEpoch.load();
+    int bucket = int( epoch % EPOCH_COUNT );
+
+    if( record.limboEpoch[ bucket ] != epoch )
+    {
+        freeBucket( record, bucket );
+
+        record.limboEpoch[ bucket ] = epoch;
+    }
+
+    retired.objectPtr = objectPtr;
+    retired.destroy = destroy;
+
+    record.limbo[ bucket ].push_back( retired );
+
+    record.retireCount++;
+
+    if( record.retireCount >= RETIRE_BATCH )
+    {
+        record.retireCount = 0;
+
+        tryAdvance();
+
+        freeExpired( record );
+    }
+}
+
+/**
+ * @brief Get record method
+ *
+ * @details Finds the record of the calling thread
+ *
+ * @pre assumes Initialized BSTEpochManager object
+ *
+ * @post Calling thread owns a record of this manager
+ *
+ * @par Algorithm
+ *      Looks up the thread cache by serial number, otherwise
+ *      claims the first free record and caches it
+ *
+ * @exception length_error if every record is claimed
+ *
+ * @param None
+ *
+ * @return Reference to record of calling thread
+ *
+ * @note A thread normally uses one or two managers, so the cache
+ *       is searched linearly
+ */
+BSTEpochManager::ThreadRecord &BSTEpochManager::getRecord
+   (
+    // no parameters
+   )
+{
+    vector< pair<unsigned long, int> > &entries = threadCache.entries;
+    size_t entryIndex;
+    int index;
+    bool expected;
+
+    for( entryIndex = 0; entryIndex < entries.size(); entryIndex++ )
+    {
+        if( entries[ entryIndex ].first == serialNumber )
+        {
+            return records[ entries[ entryIndex ].second ];
+        }
+    }
+
+    for( index = 0; index < MAX_THREADS; index++ )
+    {
+        expected = false;
+
+        if( !records[ index ].claimed
+                 && records[ index ].claimed.compare_exchange_strong(
+                                                         expected, true ) )
+        {
+            entries.push_back( make_pair( serialNumber, index ) );
+
+            return records[ index ];
+        }
+    }
+
+    throw length_error( "BSTEpochManager: too many threads" );
+}
+
+/**
+ * @brief Release record method
+ *
+ * @details Hands back the record of an exiting thread
+ *
+ * @pre assumes caller holds the registry lock and the owning
+ *      thread is exiting outside any epoch
+ *
+ * @post Record may be claimed by another thread
+ *
+ * @par Algorithm
+ *      Frees what has become safe, then clears the claimed flag;
+ *      objects not yet safe stay with the record
+ *
+ * @exception None
+ *
+ * @param [in] recordIndex
+ *             index of record to release
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTEpochManager::releaseRecord
+   (
+    int recordIndex     // input: index of record
+   )
+{
+    freeExpired( records[ recordIndex ] );
+
+    records[ recordIndex ].claimed.store( false, memory_order_release );
+}
+
+/**
+ * @brief Try advance method
+ *
+ * @details Moves the global epoch on if every thread has caught up
+ *
+ * @pre assumes Initialized BSTEpochManager object
+ *
+ * @post Global epoch is unchanged or one higher
+ *
+ * @par Algorithm
+ *      Gives up if any thread inside an epoch announced an older one,
+ *      otherwise compares and swaps the global epoch forward
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Cost is one pass over the records, paid once per RETIRE_BATCH
+ */
+void BSTEpochManager::tryAdvance
+   (
+    // no parameters
+   )
+{
+    unsigned long epoch = globalEpoch.load(), state;
+    int index;
+
+    for( index = 0; index < MAX_THREADS; index++ )
+    {
+        if( records[ index ].claimed.load( memory_order_acquire ) )
+        {
+            state = records[ index ].state.load();
+
+            if( ( state & 1 ) != 0 && state / 2 != epoch )
+            {
+                return;
+            }
+        }
+    }
+
+    globalEpoch.compare_exchange_strong( epoch, epoch + 1 );
+}
+
+/**
+ * @brief Free expired method
+ *
+ * @details Destroys retired objects no thread can still hold
+ *
+ * @pre assumes caller owns record
+ *
+ * @post Buckets two or more epochs old are empty
+ *
+ * @par Algorithm
+ *      Empties each bucket whose epoch is at least two behind
+ *      the global epoch
+ *
+ * @exception None
+ *
+ * @param [in] record
+ *             record whose limbo lists are checked
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTEpochManager::freeExpired
+   (
+    ThreadRecord &record     // input: record to check
+   )
+{
+    unsigned long epoch = globalEpoch.load();
+    int bucket;
+
+    for( bucket = 0; bucket < EPOCH_COUNT; bucket++ )
+    {
+        if( record.limboEpoch[ bucket ] + 2 <= epoch )
+        {
+            freeBucket( record, bucket );
+        }
+    }
+}
+
+/**
+ * @brief Free bucket method
+ *
+ * @details Destroys every object in one limbo list
+ *
+ * @pre assumes objects in bucket are safe to destroy
+ *
+ * @post Bucket is empty
+ *
+ * @par Algorithm
+ *      Calls each destroy function, then clears the list
+ *
+ * @exception None
+ *
+ * @param [in] record
+ *             record owning the list
+ *
+ * @param [in] bucket
+ *             index of list
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTEpochManager::freeBucket
+   (
+    ThreadRecord &record,     // input: record owning list
+    int bucket                // input: index of list
+   )
+{
+    vector<RetiredObject> &limbo = record.limbo[ bucket ];
+    size_t index;
+
+    for( index = 0; index < limbo.size(); index++ )
+    {
+        limbo[ index ].destroy( limbo[ index ].objectPtr );
+    }
+
+    limbo.clear();
+}
+
+/**
+ * @brief BSTEpochGuard constructor
+ *
+ * @details Enters an epoch for the current scope
+ *
+ * @pre assumes Uninitialized BSTEpochGuard object
+ *
+ * @post Calling thread is inside an epoch of epochManager
+ *
+ * @par Algorithm
+ *      Calls enter method of manager
+ *
+ * @exception length_error from enter
+ *
+ * @param [in] epochManager
+ *             manager to enter
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTEpochGuard::BSTEpochGuard
+   (
+    BSTEpochManager &epochManager     // input: manager to enter
+   )
+       : manager( epochManager )
+{
+    manager.enter();
+}
+
+/**
+ * @brief BSTEpochGuard destructor
+ *
+ * @details Leaves the epoch entered by the constructor
+ *
+ * @pre assumes Initialized BSTEpochGuard object
+ *
+ * @post Calling thread no longer holds back reclamation
+ *
+ * @par Algorithm
+ *      Calls exit method of manager
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTEpochGuard::~BSTEpochGuard
+   (
+    // no parameters
+   )
+{
+    manager.exit();
+}
+
+#endif  // define BST_EPOCH_MANAGER_CPP
+
@@ -0,0 +1,122 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTEpochManager.h
+ *
+ * @brief Definition file for BSTEpochManager
+ *
+ * @details Specifies all member methods of the BSTEpochManager,
+ *          epoch based reclamation for lock free containers, and
+ *          BSTEpochGuard, which keeps the calling thread inside an epoch
+ *          for the lifetime of the guard
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_EPOCH_MANAGER_H
+#define BST_EPOCH_MANAGER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <vector>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+class BSTEpochManager
+   {
+    public:
+
+       // constants
+       static const int MAX_THREADS = 256;
+       static const int EPOCH_COUNT = 3;
+       static const int RETIRE_BATCH = 64;
+       static const int CACHE_LINE_SIZE = 64;
+
+       // constructor
+       BSTEpochManager();
+
+       // destructor
+       ~BSTEpochManager();
+
+       // modifiers
+       void enter();
+       void exit();
+       void retire( void *objectPtr, void ( *destroy )( void * ) );
+
+    private:
+
+       friend struct EpochThreadCache;
+
+       struct RetiredObject
+          {
+           void *objectPtr;
+           void ( *destroy )( void * );
+          };
+
+       // one per thread, only its owner touches the limbo lists
+       struct alignas( CACHE_LINE_SIZE ) ThreadRecord
+          {
+           atomic<bool> claimed;
+
+           // announced epoch times two, plus one while inside
+           atomic<unsigned long> state;
+
+           int nestDepth;
+           int retireCount;
+
+           vector<RetiredObject> limbo[ EPOCH_COUNT ];
+           unsigned long limboEpoch[ EPOCH_COUNT ];
+          };
+
+       // not copyable, threads hold its address
+       BSTEpochManager( const BSTEpochManager &copied );
+       const BSTEpochManager &operator = ( const BSTEpochManager &rhData );
+
+       ThreadRecord &getRecord();
+
+       void releaseRecord( int recordIndex );
+
+       void tryAdvance();
+
+       void freeExpired( ThreadRecord &record );
+
+       void freeBucket( ThreadRecord &record, int bucket );
+
+       alignas( CACHE_LINE_SIZE ) atomic<unsigned long> globalEpoch;
+
+       unsigned long serialNumber;
+
+       ThreadRecord records[ MAX_THREADS ];
+   };
+
+class BSTEpochGuard
+   {
+    public:
+
+       // constructor
+       explicit BSTEpochGuard( BSTEpochManager &epochManager );
+
+       // destructor
+       ~BSTEpochGuard();
+
+    private:
+
+       // not copyable, guards one scope
+       BSTEpochGuard( const BSTEpochGuard &copied );
+       const BSTEpochGuard &operator = ( const BSTEpochGuard &rhData );
+
+       BSTEpochManager &manager;
+   };
+
+#endif	// define BST_EPOCH_MANAGER_H
+
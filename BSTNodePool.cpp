@@ -0,0 +1,388 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTNodePool.cpp
+ *
+ * @brief Implementation file for BSTNodePool
+ *
+ * @details Implements all member methods of the BSTNodePool
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_NODE_POOL_CPP
+#define BST_NODE_POOL_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <new>
+#include "BSTNodePool.h"
+
+using namespace std;
+
+/**
+ * @brief BSTNodePool default constructor
+ *
+ * @details Constructs empty BSTNodePool object
+ *
+ * @pre assumes Uninitialized BSTNodePool object
+ *
+ * @post Empty BSTNodePool object is initialized
+ *
+ * @par Algorithm
+ *      Initializes slot pointers and free list to NULL,
+ *      no block is allocated until the first node is requested
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class NodeType>
+BSTNodePool<NodeType>::BSTNodePool
+   (
+    // no parameters
+   )
+       : nextSlot( NULL ),
+         blockEnd( NULL ),
+         freeList( NULL )
+{
+    // Initializers used
+}
+
+/**
+ * @brief BSTNodePool destructor
+ *
+ * @details Destructs BSTNodePool object
+ *
+ * @pre assumes every node still in use has already been destroyed
+ *
+ * @post All blocks are freed
+ *
+ * @par Algorithm
+ *      Calls releaseAll method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class NodeType>
+BSTNodePool<NodeType>::~BSTNodePool
+   (
+    // no parameters
+   )
+{
+    releaseAll();
+}
+
+/**
+ * @brief Allocate method
+ *
+ * @details Provides raw storage for one node
+ *
+ * @pre assumes Initialized BSTNodePool object
+ *
+ * @post Returned slot is owned by the caller until released
+ *
+ * @par Algorithm
+ *      Reuses a slot from the free list if one exists,
+ *      otherwise carves the next slot out of the current block,
+ *      adding a new block when the current one is used up
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pointer to uninitialized storage for one node
+ *
+ * @note Caller constructs the node with placement new
+ */
+template <class NodeType>
+void *BSTNodePool<NodeType>::allocate
+   (
+    // no parameters
+   )
+{
+    void *slotPtr;
+
+    if( freeList != NULL )
+    {
+        slotPtr = freeList;
+        freeList = freeList->next;
+
+        return slotPtr;
+    }
+
+    if( nextSlot == blockEnd )
+    {
+        addBlock( NODES_PER_BLOCK );
+    }
+
+    slotPtr = nextSlot;
+    nextSlot += sizeof( NodeType );
+
+    return slotPtr;
+}
+
+/**
+ * @brief Release method
+ *
+ * @details Destroys one node and recycles its slot
+ *
+ * @pre assumes nodePtr was allocated from this pool
+ *
+ * @post Node is destroyed, its slot is on the free list
+ *
+ * @par Algorithm
+ *      Calls node destructor, then pushes slot onto free list
+ *
+ * @exception None
+ *
+ * @param [in] nodePtr
+ *             node to be released
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class NodeType>
+void BSTNodePool<NodeType>::release
+   (
+    NodeType *nodePtr     // input: node to be released
+   )
+{
+    FreeSlot *slotPtr;
+
+    nodePtr->~NodeType();
+
+    slotPtr = reinterpret_cast<FreeSlot *>( nodePtr );
+    slotPtr->next = freeList;
+    freeList = slotPtr;
+}
+
+/**
+ * @brief Release all method
+ *
+ * @details Frees every block at once
+ *
+ * @pre assumes nodes still in blocks need no destruction
+ *      or have already been destroyed
+ *
+ * @post Pool is empty
+ *
+ * @par Algorithm
+ *      Deletes each block, cost is proportional to number of blocks
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class NodeType>
+void BSTNodePool<NodeType>::releaseAll
+   (
+    // no parameters
+   )
+{
+    size_t index;
+
+    for( index = 0; index < blocks.size(); index++ )
+    {
+        ::operator delete( blocks[ index ] );
+    }
+
+    blocks.clear();
+
+    nextSlot = NULL;
+    blockEnd = NULL;
+    freeList = NULL;
+}
+
+/**
+ * @brief Reserve method
+ *
+ * @details Makes room for a run of nodes in one block
+ *
+ * @pre assumes Initialized BSTNodePool object
+ *
+ * @post Next nodeCount allocations that miss the free list come from
+ *       consecutive slots of one block
+ *
+ * @par Algorithm
+ *      Adds a block of at least nodeCount slots if the current block
+ *      has fewer left; remaining slots of the old block are abandoned
+ *      until releaseAll
+ *
+ * @exception bad_alloc from operator new
+ *
+ * @param [in] nodeCount
+ *             number of nodes about to be allocated
+ *
+ * @return None
+ *
+ * @note Used by bulk builds so the whole tree is one allocation
+ */
+template <class NodeType>
+void BSTNodePool<NodeType>::reserve
+   (
+    int nodeCount     // input: number of nodes needed
+   )
+{
+    if( size_t( blockEnd - nextSlot ) < nodeCount * sizeof( NodeType ) )
+    {
+        if( nodeCount < NODES_PER_BLOCK )
+        {
+            nodeCount = NODES_PER_BLOCK;
+        }
+
+        addBlock( nodeCount );
+    }
+}
+
+/**
+ * @brief Allocate run method
+ *
+ * @details Provides raw storage for a run of consecutive nodes
+ *
+ * @pre assumes Initialized BSTNodePool object
+ *
+ * @post Returned slots are owned by the caller until released
+ *
+ * @par Algorithm
+ *      Calls reserve method, then takes nodeCount slots at once
+ *
+ * @exception bad_alloc from operator new
+ *
+ * @param [in] nodeCount
+ *             number of slots needed
+ *
+ * @return Pointer to first of nodeCount uninitialized slots
+ *
+ * @note Slots may be constructed by several threads at once,
+ *       each slot is released individually like any other node
+ */
+template <class NodeType>
+NodeType *BSTNodePool<NodeType>::allocateRun
+   (
+    int nodeCount     // input: number of slots needed
+   )
+{
+    NodeType *runPtr;
+
+    reserve( nodeCount );
+
+    runPtr = reinterpret_cast<NodeType *>( nextSlot );
+    nextSlot += nodeCount * sizeof( NodeType );
+
+    return runPtr;
+}
+
+/**
+ * @brief Absorb method
+ *
+ * @details Takes over every block and free slot of another pool
+ *
+ * @pre assumes no other thread is using either pool
+ *
+ * @post Nodes allocated from other may be released to this pool,
+ *       other is empty
+ *
+ * @par Algorithm
+ *      Moves block list over, then moves each free slot of other,
+ *      including those never handed out, to this free list
+ *
+ * @exception bad_alloc if block list can not grow
+ *
+ * @param [in] other
+ *             pool to be emptied into this one
+ *
+ * @return None
+ *
+ * @note Lets threads fill private pools at once, then hand the nodes
+ *       to one tree; cost is at most one block of slots per pool
+ */
+template <class NodeType>
+void BSTNodePool<NodeType>::absorb
+   (
+    BSTNodePool<NodeType> &other     // input: pool to be emptied
+   )
+{
+    FreeSlot *slotPtr;
+
+    blocks.insert( blocks.end(), other.blocks.begin(), other.blocks.end() );
+
+    while( other.nextSlot != other.blockEnd )
+    {
+        slotPtr = reinterpret_cast<FreeSlot *>( other.nextSlot );
+        slotPtr->next = freeList;
+        freeList = slotPtr;
+
+        other.nextSlot += sizeof( NodeType );
+    }
+
+    while( other.freeList != NULL )
+    {
+        slotPtr = other.freeList;
+        other.freeList = slotPtr->next;
+
+        slotPtr->next = freeList;
+        freeList = slotPtr;
+    }
+
+    other.blocks.clear();
+
+    other.nextSlot = NULL;
+    other.blockEnd = NULL;
+}
+
+/**
+ * @brief Add block method
+ *
+ * @details Allocates a new block of node slots
+ *
+ * @pre assumes current block is used up
+ *
+ * @post New block is current
+ *
+ * @par Algorithm
+ *      Allocates nodeCount slots in one contiguous block
+ *
+ * @exception bad_alloc from operator new
+ *
+ * @param [in] nodeCount
+ *             number of slots in block
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class NodeType>
+void BSTNodePool<NodeType>::addBlock
+   (
+    int nodeCount     // input: number of slots
+   )
+{
+    char *blockPtr = static_cast<char *>(
+                         ::operator new( nodeCount * sizeof( NodeType ) ) );
+
+    blocks.push_back( blockPtr );
+
+    nextSlot = blockPtr;
+    blockEnd = blockPtr + nodeCount * sizeof( NodeType );
+}
+
+#endif  // define BST_NODE_POOL_CPP
+
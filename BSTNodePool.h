@@ -0,0 +1,77 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTNodePool.h
+ *
+ * @brief Definition file for BSTNodePool
+ *
+ * @details Specifies all member methods of the BSTNodePool,
+ *          a slab allocator for tree nodes
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_NODE_POOL_H
+#define BST_NODE_POOL_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <vector>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+template <typename NodeType>
+class BSTNodePool
+   {
+    public:
+
+       // constants
+       static const int NODES_PER_BLOCK = 4096;
+
+       // constructor
+       BSTNodePool();
+
+       // destructor
+       ~BSTNodePool();
+
+       // modifiers
+       void *allocate();
+       void release( NodeType *nodePtr );
+       void releaseAll();
+       void reserve( int nodeCount );
+       NodeType *allocateRun( int nodeCount );
+       void absorb( BSTNodePool<NodeType> &other );
+
+    private:
+
+       // free slots are linked through their own storage
+       struct FreeSlot
+          {
+           FreeSlot *next;
+          };
+
+       // not copyable, nodes belong to exactly one pool
+       BSTNodePool( const BSTNodePool<NodeType> &copied );
+       const BSTNodePool &operator = ( const BSTNodePool<NodeType> &rhData );
+
+       void addBlock( int nodeCount );
+
+       vector<char *> blocks;
+
+       char *nextSlot;
+       char *blockEnd;
+
+       FreeSlot *freeList;
+   };
+
+#endif	// define BST_NODE_POOL_H
+
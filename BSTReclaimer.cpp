@@ -0,0 +1,408 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTReclaimer.cpp
+ *
+ * @brief Implementation file for BSTReclaimer
+ *
+ * @details Implements all member methods of the BSTReclaimer
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires BSTReclaimer.h
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_RECLAIMER_CPP
+#define BST_RECLAIMER_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "BSTReclaimer.h"
+
+using namespace std;
+
+/**
+ * @brief BSTReclaimer constructor
+ *
+ * @details Constructs reclaimer and starts its thread
+ *
+ * @pre assumes Uninitialized BSTReclaimer object
+ *
+ * @post Reclaiming thread is waiting for jobs
+ *
+ * @par Algorithm
+ *      Initializes counters, then starts the reclaiming thread
+ *
+ * @exception system_error if the thread cannot be started
+ *
+ * @param [in] pendingLimit
+ *             most bytes that may wait to be freed at once
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTReclaimer::BSTReclaimer
+   (
+    size_t pendingLimit     // input: bound on pending bytes
+   )
+       : pendingBytes( 0 ),
+         limitBytes( pendingLimit ),
+         busy( false ),
+         stopping( false )
+{
+    reclaimThread = thread( &BSTReclaimer::reclaimLoop, this );
+}
+
+/**
+ * @brief BSTReclaimer destructor
+ *
+ * @details Finishes pending jobs and destructs reclaimer
+ *
+ * @pre assumes no thread defers after destruction starts
+ *
+ * @post Every deferred graph is freed, the thread is joined
+ *
+ * @par Algorithm
+ *      Sets stopping flag, wakes the thread and joins it;
+ *      the thread only stops once the queue is empty
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTReclaimer::~BSTReclaimer
+   (
+    // no parameters
+   )
+{
+       {
+        lock_guard<mutex> jobGuard( jobLock );
+
+        stopping = true;
+       }
+
+    jobCondition.notify_all();
+
+    reclaimThread.join();
+}
+
+/**
+ * @brief Defer method
+ *
+ * @details Hands a detached node graph to the reclaiming thread
+ *
+ * @pre assumes no other thread can reach the graph
+ *
+ * @post Graph will be freed on the reclaiming thread, unless
+ *       false is returned
+ *
+ * @par Algorithm
+ *      Refuses a graph larger than the whole limit; otherwise waits
+ *      until the graph fits under the limit, queues it and wakes
+ *      the reclaiming thread
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] step
+ *             frees up to the given number of nodes, returns true once
+ *             the whole graph is freed; must not throw
+ *
+ * @param [in] graphBytes
+ *             bytes held by the graph, an upper bound is enough
+ *
+ * @param [in] nodeBytes
+ *             bytes freed per node
+ *
+ * @return Bool with true if graph was queued, false if caller
+ *         must free it
+ *
+ * @note Waiting is the bound on pending memory; a caller that drops
+ *       trees faster than they are freed is slowed to that rate
+ */
+bool BSTReclaimer::defer
+   (
+    const function<bool( int )> &step,      // input: frees some nodes
+    size_t graphBytes,                      // input: bytes of graph
+    size_t nodeBytes                        // input: bytes per node
+   )
+{
+    ReclaimJob newJob;
+    unique_lock<mutex> jobGuard( jobLock );
+
+    if( graphBytes > limitBytes )
+    {
+        return false;
+    }
+
+    while( pendingBytes + graphBytes > limitBytes )
+    {
+        roomCondition.wait( jobGuard );
+    }
+
+    newJob.step = step;
+    newJob.remainingBytes = graphBytes;
+    newJob.nodeBytes = nodeBytes;
+
+    jobs.push_back( newJob );
+
+    pendingBytes += graphBytes;
+
+    jobGuard.unlock();
+
+    jobCondition.notify_one();
+
+    return true;
+}
+
+/**
+ * @brief Drain method
+ *
+ * @details Waits until every deferred graph is freed
+ *
+ * @pre assumes Initialized BSTReclaimer object
+ *
+ * @post No job is queued or running
+ *
+ * @par Algorithm
+ *      Sleeps on the room condition until the queue is empty
+ *      and the thread is idle
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note For benchmarks and shutdown, the reclaimer never needs it
+ */
+void BSTReclaimer::drain
+   (
+    // no parameters
+   )
+{
+    unique_lock<mutex> jobGuard( jobLock );
+
+    while( !jobs.empty() || busy )
+    {
+        roomCondition.wait( jobGuard );
+    }
+}
+
+/**
+ * @brief Set pending limit method
+ *
+ * @details Changes the bound on bytes waiting to be freed
+ *
+ * @pre assumes Initialized BSTReclaimer object
+ *
+ * @post Later defers are held to the new limit
+ *
+ * @par Algorithm
+ *      Stores limit and wakes waiting threads, which may now fit
+ *
+ * @exception None
+ *
+ * @param [in] pendingLimit
+ *             most bytes that may wait to be freed at once
+ *
+ * @return None
+ *
+ * @note Lowering the limit frees nothing early
+ */
+void BSTReclaimer::setPendingLimit
+   (
+    size_t pendingLimit     // input: bound on pending bytes
+   )
+{
+       {
+        lock_guard<mutex> jobGuard( jobLock );
+
+        limitBytes = pendingLimit;
+       }
+
+    roomCondition.notify_all();
+}
+
+/**
+ * @brief Get pending bytes method
+ *
+ * @details Gives bytes deferred but not yet freed
+ *
+ * @pre assumes Initialized BSTReclaimer object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Reads counter under the job lock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pending bytes, as estimated by the deferring trees
+ *
+ * @note None
+ */
+size_t BSTReclaimer::getPendingBytes
+   (
+    // no parameters
+   ) const
+{
+    lock_guard<mutex> jobGuard( jobLock );
+
+    return pendingBytes;
+}
+
+/**
+ * @brief Get pending limit method
+ *
+ * @details Gives the bound on bytes waiting to be freed
+ *
+ * @pre assumes Initialized BSTReclaimer object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Reads limit under the job lock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pending limit in bytes
+ *
+ * @note None
+ */
+size_t BSTReclaimer::getPendingLimit
+   (
+    // no parameters
+   ) const
+{
+    lock_guard<mutex> jobGuard( jobLock );
+
+    return limitBytes;
+}
+
+/**
+ * @brief Get shared method
+ *
+ * @details Gives the reclaimer used by trees with DEFERRED_FREE
+ *
+ * @pre None
+ *
+ * @post Shared reclaimer exists
+ *
+ * @par Algorithm
+ *      Creates the reclaimer on first use, with the default limit
+ *
+ * @exception system_error if the thread cannot be started
+ *
+ * @param None
+ *
+ * @return Reference to the shared reclaimer
+ *
+ * @note Never destroyed, so trees destructed during program exit can
+ *       still defer; graphs pending at exit are left to the system
+ */
+BSTReclaimer &BSTReclaimer::getShared
+   (
+    // no parameters
+   )
+{
+    static BSTReclaimer *sharedReclaimer
+                               = new BSTReclaimer( DEFAULT_PENDING_LIMIT );
+
+    return *sharedReclaimer;
+}
+
+/**
+ * @brief Reclaim loop method
+ *
+ * @details Body of the reclaiming thread
+ *
+ * @pre assumes called once by the constructor
+ *
+ * @post Thread has stopped
+ *
+ * @par Algorithm
+ *      Takes the oldest job and runs its step NODES_PER_STEP nodes at
+ *      a time, yielding and crediting the freed bytes after each step;
+ *      sleeps when no job is queued, exits once stopping with
+ *      nothing queued
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Bytes are credited per step so a waiting defer can go ahead
+ *       before a large graph is entirely freed
+ */
+void BSTReclaimer::reclaimLoop
+   (
+    // no parameters
+   )
+{
+    ReclaimJob currentJob;
+    size_t freedBytes;
+    bool finished;
+
+    while( true )
+    {
+           {
+            unique_lock<mutex> jobGuard( jobLock );
+
+            while( jobs.empty() && !stopping )
+            {
+                jobCondition.wait( jobGuard );
+            }
+
+            if( jobs.empty() )
+            {
+                return;
+            }
+
+            currentJob = jobs.front();
+            jobs.pop_front();
+
+            busy = true;
+           }
+
+        finished = false;
+
+        while( !finished )
+        {
+            finished = currentJob.step( NODES_PER_STEP );
+
+            freedBytes = currentJob.nodeBytes * NODES_PER_STEP;
+
+            if( finished || freedBytes > currentJob.remainingBytes )
+            {
+                freedBytes = currentJob.remainingBytes;
+            }
+
+               {
+                lock_guard<mutex> jobGuard( jobLock );
+
+                currentJob.remainingBytes -= freedBytes;
+                pendingBytes -= freedBytes;
+
+                busy = !finished;
+               }
+
+            roomCondition.notify_all();
+
+            this_thread::yield();
+        }
+    }
+}
+
+#endif  // define BST_RECLAIMER_CPP
+
@@ -0,0 +1,98 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTReclaimer.h
+ *
+ * @brief Definition file for BSTReclaimer
+ *
+ * @details Specifies all member methods of the BSTReclaimer,
+ *          a background thread that frees detached node graphs
+ *          a batch at a time, with a bound on memory still pending
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_RECLAIMER_H
+#define BST_RECLAIMER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+class BSTReclaimer
+   {
+    public:
+
+       // constants
+       static const size_t DEFAULT_PENDING_LIMIT = size_t( 256 ) << 20;
+       static const int NODES_PER_STEP = 4096;
+
+       // constructor
+       explicit BSTReclaimer( size_t pendingLimit );
+
+       // destructor
+       ~BSTReclaimer();
+
+       // modifiers
+       bool defer( const function<bool( int )> &step, size_t graphBytes,
+                                                        size_t nodeBytes );
+       void drain();
+       void setPendingLimit( size_t pendingLimit );
+
+       // accessors
+       size_t getPendingBytes() const;
+       size_t getPendingLimit() const;
+
+       static BSTReclaimer &getShared();
+
+    private:
+
+       struct ReclaimJob
+          {
+           function<bool( int )> step;
+           size_t remainingBytes;
+           size_t nodeBytes;
+          };
+
+       // not copyable, the reclaiming thread holds its address
+       BSTReclaimer( const BSTReclaimer &copied );
+       const BSTReclaimer &operator = ( const BSTReclaimer &rhData );
+
+       void reclaimLoop();
+
+       deque<ReclaimJob> jobs;
+
+       mutable mutex jobLock;
+
+       // reclaiming thread waits here for jobs
+       condition_variable jobCondition;
+
+       // deferring and draining threads wait here for bytes to be freed
+       condition_variable roomCondition;
+
+       size_t pendingBytes;
+       size_t limitBytes;
+       bool busy;
+       bool stopping;
+
+       thread reclaimThread;
+   };
+
+#endif	// define BST_RECLAIMER_H
+
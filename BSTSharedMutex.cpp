@@ -0,0 +1,264 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTSharedMutex.cpp
+ *
+ * @brief Implementation file for BSTSharedMutex
+ *
+ * @details Implements all member methods of the BSTSharedMutex
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires BSTSharedMutex.h
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_SHARED_MUTEX_CPP
+#define BST_SHARED_MUTEX_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "BSTSharedMutex.h"
+
+using namespace std;
+
+/**
+ * @brief BSTSharedMutex default constructor
+ *
+ * @details Constructs unlocked BSTSharedMutex
+ *
+ * @pre assumes Uninitialized BSTSharedMutex object
+ *
+ * @post Lock is free
+ *
+ * @par Algorithm
+ *      Initializes a writer preferring rwlock where the C library
+ *      offers one, otherwise the default rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note The glibc default, like std::shared_mutex built on it, admits
+ *       new readers while a writer waits, so a steady stream of finds
+ *       can starve inserts indefinitely
+ */
+BSTSharedMutex::BSTSharedMutex
+   (
+    // no parameters
+   )
+{
+    pthread_rwlockattr_t lockAttributes;
+
+    pthread_rwlockattr_init( &lockAttributes );
+
+#ifdef __GLIBC__
+    pthread_rwlockattr_setkind_np( &lockAttributes,
+                              PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP );
+#endif
+
+    pthread_rwlock_init( &rwLock, &lockAttributes );
+
+    pthread_rwlockattr_destroy( &lockAttributes );
+}
+
+/**
+ * @brief BSTSharedMutex destructor
+ *
+ * @details Destructs BSTSharedMutex
+ *
+ * @pre assumes lock is free
+ *
+ * @post Lock is destroyed
+ *
+ * @par Algorithm
+ *      Destroys rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTSharedMutex::~BSTSharedMutex
+   (
+    // no parameters
+   )
+{
+    pthread_rwlock_destroy( &rwLock );
+}
+
+/**
+ * @brief Lock method
+ *
+ * @details Takes exclusive access
+ *
+ * @pre assumes calling thread holds no lock on this object
+ *
+ * @post Calling thread is the only holder
+ *
+ * @par Algorithm
+ *      Write locks rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTSharedMutex::lock
+   (
+    // no parameters
+   )
+{
+    pthread_rwlock_wrlock( &rwLock );
+}
+
+/**
+ * @brief Try lock method
+ *
+ * @details Takes exclusive access if it is free
+ *
+ * @pre assumes calling thread holds no lock on this object
+ *
+ * @post Calling thread is the only holder if true is returned
+ *
+ * @par Algorithm
+ *      Tries to write lock rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if lock was taken
+ *
+ * @note None
+ */
+bool BSTSharedMutex::try_lock
+   (
+    // no parameters
+   )
+{
+    return pthread_rwlock_trywrlock( &rwLock ) == 0;
+}
+
+/**
+ * @brief Unlock method
+ *
+ * @details Gives up exclusive access
+ *
+ * @pre assumes calling thread holds the lock exclusively
+ *
+ * @post Lock is free
+ *
+ * @par Algorithm
+ *      Unlocks rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTSharedMutex::unlock
+   (
+    // no parameters
+   )
+{
+    pthread_rwlock_unlock( &rwLock );
+}
+
+/**
+ * @brief Lock shared method
+ *
+ * @details Takes shared access
+ *
+ * @pre assumes calling thread holds no lock on this object
+ *
+ * @post Calling thread is one of the readers
+ *
+ * @par Algorithm
+ *      Read locks rwlock, waiting behind any waiting writer
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Taking it twice on one thread can deadlock with a waiting writer
+ */
+void BSTSharedMutex::lock_shared
+   (
+    // no parameters
+   )
+{
+    pthread_rwlock_rdlock( &rwLock );
+}
+
+/**
+ * @brief Try lock shared method
+ *
+ * @details Takes shared access if no writer holds or awaits it
+ *
+ * @pre assumes calling thread holds no lock on this object
+ *
+ * @post Calling thread is one of the readers if true is returned
+ *
+ * @par Algorithm
+ *      Tries to read lock rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if lock was taken
+ *
+ * @note None
+ */
+bool BSTSharedMutex::try_lock_shared
+   (
+    // no parameters
+   )
+{
+    return pthread_rwlock_tryrdlock( &rwLock ) == 0;
+}
+
+/**
+ * @brief Unlock shared method
+ *
+ * @details Gives up shared access
+ *
+ * @pre assumes calling thread is one of the readers
+ *
+ * @post Calling thread holds no lock
+ *
+ * @par Algorithm
+ *      Unlocks rwlock
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTSharedMutex::unlock_shared
+   (
+    // no parameters
+   )
+{
+    pthread_rwlock_unlock( &rwLock );
+}
+
+#endif  // define BST_SHARED_MUTEX_CPP
+
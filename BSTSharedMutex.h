@@ -0,0 +1,63 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTSharedMutex.h
+ *
+ * @brief Definition file for BSTSharedMutex
+ *
+ * @details Specifies all member methods of the BSTSharedMutex,
+ *          a reader-writer lock that lets a waiting writer in ahead
+ *          of readers arriving after it
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Usable with unique_lock and shared_lock
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_SHARED_MUTEX_H
+#define BST_SHARED_MUTEX_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+class BSTSharedMutex
+   {
+    public:
+
+       // constructor
+       BSTSharedMutex();
+
+       // destructor
+       ~BSTSharedMutex();
+
+       // exclusive locking
+       void lock();
+       bool try_lock();
+       void unlock();
+
+       // shared locking
+       void lock_shared();
+       bool try_lock_shared();
+       void unlock_shared();
+
+    private:
+
+       // not copyable, threads hold its address
+       BSTSharedMutex( const BSTSharedMutex &copied );
+       const BSTSharedMutex &operator = ( const BSTSharedMutex &rhData );
+
+       pthread_rwlock_t rwLock;
+   };
+
+#endif	// define BST_SHARED_MUTEX_H
+
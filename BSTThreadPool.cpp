@@ -0,0 +1,500 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTThreadPool.cpp
+ *
+ * @brief Implementation file for BSTThreadPool
+ *
+ * @details Implements all member methods of the BSTThreadPool
+ *          and BSTTaskGroup
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires BSTThreadPool.h
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_THREAD_POOL_CPP
+#define BST_THREAD_POOL_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "BSTThreadPool.h"
+
+using namespace std;
+
+// pool and index of the worker running on this thread, if any
+static thread_local const BSTThreadPool *currentPool = NULL;
+static thread_local int currentIndex = BSTThreadPool::NOT_A_WORKER;
+
+/**
+ * @brief BSTTaskGroup default constructor
+ *
+ * @details Constructs empty task group
+ *
+ * @pre assumes Uninitialized BSTTaskGroup object
+ *
+ * @post Group has no pending tasks
+ *
+ * @par Algorithm
+ *      Initializes pending count to zero
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTTaskGroup::BSTTaskGroup
+   (
+    // no parameters
+   )
+       : pendingCount( 0 )
+{
+    // Initializer used
+}
+
+/**
+ * @brief BSTThreadPool constructor
+ *
+ * @details Constructs pool and starts its workers
+ *
+ * @pre assumes Uninitialized BSTThreadPool object
+ *
+ * @post numThreads workers are waiting for tasks
+ *
+ * @par Algorithm
+ *      Creates one queue per worker, then starts each worker
+ *
+ * @exception system_error if a thread cannot be started
+ *
+ * @param [in] numThreads
+ *             number of workers, at least one is started
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTThreadPool::BSTThreadPool
+   (
+    int numThreads     // input: number of workers
+   )
+       : nextQueue( 0 ),
+         queuedCount( 0 ),
+         stopping( false )
+{
+    int index;
+
+    if( numThreads < 1 )
+    {
+        numThreads = 1;
+    }
+
+    for( index = 0; index < numThreads; index++ )
+    {
+        queues.push_back( new WorkerQueue );
+    }
+
+    for( index = 0; index < numThreads; index++ )
+    {
+        workers.push_back( thread( &BSTThreadPool::workerLoop, this, index ) );
+    }
+}
+
+/**
+ * @brief BSTThreadPool destructor
+ *
+ * @details Stops workers and destructs pool
+ *
+ * @pre assumes no thread submits after destruction starts
+ *
+ * @post Queued tasks have run, all workers are joined
+ *
+ * @par Algorithm
+ *      Sets stopping flag, wakes all workers, joins them,
+ *      then frees queues
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+BSTThreadPool::~BSTThreadPool
+   (
+    // no parameters
+   )
+{
+    size_t index;
+
+       {
+        lock_guard<mutex> sleepGuard( sleepLock );
+
+        stopping = true;
+       }
+
+    sleepCondition.notify_all();
+
+    for( index = 0; index < workers.size(); index++ )
+    {
+        workers[ index ].join();
+    }
+
+    for( index = 0; index < queues.size(); index++ )
+    {
+        delete queues[ index ];
+    }
+}
+
+/**
+ * @brief Submit method
+ *
+ * @details Queues task as part of group
+ *
+ * @pre assumes group outlives the task
+ *
+ * @post Task will be run by some worker
+ *
+ * @par Algorithm
+ *      A worker pushes onto its own queue so nested tasks stay local,
+ *      other threads spread tasks over the queues in turn;
+ *      then one sleeping worker is woken
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] group
+ *             group the task belongs to
+ *
+ * @param [in] task
+ *             work to be run, must not throw
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTThreadPool::submit
+   (
+    BSTTaskGroup &group,                 // input: group of task
+    const function<void()> &task         // input: work to be run
+   )
+{
+    int queueIndex = getWorkerIndex();
+    PoolTask newTask;
+
+    if( queueIndex == NOT_A_WORKER )
+    {
+        queueIndex = int( nextQueue++ % queues.size() );
+    }
+
+    newTask.run = task;
+    newTask.group = &group;
+
+    group.pendingCount++;
+
+       {
+        lock_guard<mutex> queueGuard( queues[ queueIndex ]->queueLock );
+
+        queues[ queueIndex ]->tasks.push_back( newTask );
+       }
+
+       {
+        lock_guard<mutex> sleepGuard( sleepLock );
+
+        queuedCount++;
+       }
+
+    sleepCondition.notify_one();
+}
+
+/**
+ * @brief Wait method
+ *
+ * @details Waits until every task of group has run
+ *
+ * @pre assumes Initialized BSTThreadPool object
+ *
+ * @post No task of group is pending
+ *
+ * @par Algorithm
+ *      A worker keeps running queued tasks while it waits, so nested
+ *      waits cannot starve the pool; other threads sleep until the
+ *      last task of the group finishes
+ *
+ * @exception None
+ *
+ * @param [in] group
+ *             group to wait for
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTThreadPool::wait
+   (
+    BSTTaskGroup &group     // input: group to wait for
+   )
+{
+    int workerIndex = getWorkerIndex();
+    PoolTask task;
+
+    if( workerIndex != NOT_A_WORKER )
+    {
+        while( group.pendingCount > 0 )
+        {
+            if( popTask( workerIndex, task ) )
+            {
+                runTask( task );
+            }
+
+            else
+            {
+                this_thread::yield();
+            }
+        }
+    }
+
+    else
+    {
+        unique_lock<mutex> doneGuard( doneLock );
+
+        while( group.pendingCount > 0 )
+        {
+            doneCondition.wait( doneGuard );
+        }
+    }
+}
+
+/**
+ * @brief Get thread count method
+ *
+ * @details Gives number of workers
+ *
+ * @pre assumes Initialized BSTThreadPool object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Returns number of queues, one per worker
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Number of workers
+ *
+ * @note None
+ */
+int BSTThreadPool::getThreadCount
+   (
+    // no parameters
+   ) const
+{
+    return int( queues.size() );
+}
+
+/**
+ * @brief Get worker index method
+ *
+ * @details Identifies the calling worker
+ *
+ * @pre assumes Initialized BSTThreadPool object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Checks the pool recorded for this thread
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Index from 0 to getThreadCount() - 1 when called by a worker
+ *         of this pool, NOT_A_WORKER otherwise
+ *
+ * @note Lets tasks keep one result per worker without locking
+ */
+int BSTThreadPool::getWorkerIndex
+   (
+    // no parameters
+   ) const
+{
+    if( currentPool == this )
+    {
+        return currentIndex;
+    }
+
+    return NOT_A_WORKER;
+}
+
+/**
+ * @brief Pop task method
+ *
+ * @details Finds a task to run
+ *
+ * @pre assumes Initialized BSTThreadPool object
+ *
+ * @post Task, if found, is removed from its queue
+ *
+ * @par Algorithm
+ *      Takes the newest task of the worker's own queue, otherwise
+ *      steals the oldest task of the next non empty queue
+ *
+ * @exception None
+ *
+ * @param [in] workerIndex
+ *             index of calling worker
+ *
+ * @param [out] task
+ *              task found
+ *
+ * @return Bool with true if a task was found
+ *
+ * @note None
+ */
+bool BSTThreadPool::popTask
+   (
+    int workerIndex,     // input: index of calling worker
+    PoolTask &task       // output: task found
+   )
+{
+    int queueCount = int( queues.size() ), offset;
+    bool found = false;
+    WorkerQueue *queuePtr = queues[ workerIndex ];
+
+       {
+        lock_guard<mutex> queueGuard( queuePtr->queueLock );
+
+        if( !queuePtr->tasks.empty() )
+        {
+            task = queuePtr->tasks.back();
+            queuePtr->tasks.pop_back();
+
+            found = true;
+        }
+       }
+
+    for( offset = 1; !found && offset < queueCount; offset++ )
+    {
+        queuePtr = queues[ ( workerIndex + offset ) % queueCount ];
+
+        lock_guard<mutex> queueGuard( queuePtr->queueLock );
+
+        if( !queuePtr->tasks.empty() )
+        {
+            task = queuePtr->tasks.front();
+            queuePtr->tasks.pop_front();
+
+            found = true;
+        }
+    }
+
+    if( found )
+    {
+        lock_guard<mutex> sleepGuard( sleepLock );
+
+        queuedCount--;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Run task method
+ *
+ * @details Runs task and retires it from its group
+ *
+ * @pre assumes task was popped from a queue
+ *
+ * @post Group has one fewer pending task
+ *
+ * @par Algorithm
+ *      Runs task, then wakes outside waiters if it was the
+ *      last task of its group
+ *
+ * @exception None
+ *
+ * @param [in] task
+ *             task to be run
+ *
+ * @return None
+ *
+ * @note Group is not touched after its count reaches zero,
+ *       the waiter may destroy it at once
+ */
+void BSTThreadPool::runTask
+   (
+    PoolTask &task     // input: task to be run
+   )
+{
+    task.run();
+
+    if( task.group->pendingCount.fetch_sub( 1 ) == 1 )
+    {
+        lock_guard<mutex> doneGuard( doneLock );
+
+        doneCondition.notify_all();
+    }
+}
+
+/**
+ * @brief Worker loop method
+ *
+ * @details Body of each worker thread
+ *
+ * @pre assumes called once per worker by the constructor
+ *
+ * @post Worker has stopped
+ *
+ * @par Algorithm
+ *      Runs tasks while any can be found, otherwise sleeps until
+ *      a task is queued; exits once stopping with nothing queued
+ *
+ * @exception None
+ *
+ * @param [in] workerIndex
+ *             index of this worker
+ *
+ * @return None
+ *
+ * @note None
+ */
+void BSTThreadPool::workerLoop
+   (
+    int workerIndex     // input: index of this worker
+   )
+{
+    PoolTask task;
+
+    currentPool = this;
+    currentIndex = workerIndex;
+
+    while( true )
+    {
+        if( popTask( workerIndex, task ) )
+        {
+            runTask( task );
+        }
+
+        else
+        {
+            unique_lock<mutex> sleepGuard( sleepLock );
+
+            while( queuedCount == 0 && !stopping )
+            {
+                sleepCondition.wait( sleepGuard );
+            }
+
+            if( queuedCount == 0 && stopping )
+            {
+                return;
+            }
+        }
+    }
+}
+
+#endif  // define BST_THREAD_POOL_CPP
+
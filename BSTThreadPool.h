@@ -0,0 +1,122 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BSTThreadPool.h
+ *
+ * @brief Definition file for BSTThreadPool
+ *
+ * @details Specifies all member methods of the BSTThreadPool,
+ *          a work stealing pool of worker threads, and BSTTaskGroup,
+ *          a set of tasks that can be waited on together
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BST_THREAD_POOL_H
+#define BST_THREAD_POOL_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+class BSTTaskGroup
+   {
+    public:
+
+       // constructor
+       BSTTaskGroup();
+
+    private:
+
+       friend class BSTThreadPool;
+
+       // not copyable, pool holds its address until tasks finish
+       BSTTaskGroup( const BSTTaskGroup &copied );
+       const BSTTaskGroup &operator = ( const BSTTaskGroup &rhData );
+
+       atomic<int> pendingCount;
+   };
+
+class BSTThreadPool
+   {
+    public:
+
+       // constants
+       static const int NOT_A_WORKER = -1;
+
+       // constructor
+       explicit BSTThreadPool( int numThreads );
+
+       // destructor
+       ~BSTThreadPool();
+
+       // modifiers
+       void submit( BSTTaskGroup &group, const function<void()> &task );
+       void wait( BSTTaskGroup &group );
+
+       // accessors
+       int getThreadCount() const;
+       int getWorkerIndex() const;
+
+    private:
+
+       struct PoolTask
+          {
+           function<void()> run;
+           BSTTaskGroup *group;
+          };
+
+       // each worker pushes and pops at the back of its own queue,
+       // idle workers steal from the front of the others
+       struct WorkerQueue
+          {
+           mutex queueLock;
+           deque<PoolTask> tasks;
+          };
+
+       // not copyable, workers hold its address
+       BSTThreadPool( const BSTThreadPool &copied );
+       const BSTThreadPool &operator = ( const BSTThreadPool &rhData );
+
+       bool popTask( int workerIndex, PoolTask &task );
+
+       void runTask( PoolTask &task );
+
+       void workerLoop( int workerIndex );
+
+       vector<thread> workers;
+
+       vector<WorkerQueue *> queues;
+
+       atomic<unsigned> nextQueue;
+
+       // sleeping workers wait here for queued tasks
+       mutex sleepLock;
+       condition_variable sleepCondition;
+       int queuedCount;
+       bool stopping;
+
+       // outside threads wait here for their group to finish
+       mutex doneLock;
+       condition_variable doneCondition;
+   };
+
+#endif	// define BST_THREAD_POOL_H
+
@@ -0,0 +1,1416 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BTreeClass.cpp
+ *
+ * @brief Implementation file for BTreeClass
+ *
+ * @details Implements all member methods of the BTreeClass
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BTREE_CLASS_CPP
+#define BTREE_CLASS_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+#include "BTreeClass.h"
+
+using namespace std;
+
+/**
+ * @brief Initialization BTreeNode constructor
+ *
+ * @details Constructs empty BTreeNode
+ *
+ * @pre assumes Uninitialized BTreeNode object
+ *
+ * @post BTreeNode object holds no keys and no children
+ *
+ * @par Algorithm
+ *      Calls initializers on member data, clears child pointers
+ *
+ * @exception None
+ *
+ * @param [in] isLeaf
+ *             true if node is a leaf
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BTreeNode<DataType>::BTreeNode
+   (
+    bool isLeaf     // input: leaf flag
+   )
+       : keyCount( 0 ),
+         leaf( isLeaf )
+{
+    int index;
+
+    for( index = 0; index <= MAX_KEYS; index++ )
+    {
+        children[ index ] = NULL;
+    }
+}
+
+/**
+ * @brief BTreeClass default constructor
+ *
+ * @details Constructs BTreeClass object
+ *
+ * @pre assumes Uninitialized BTreeClass object
+ *
+ * @post Empty BTreeClass object is initialized
+ *
+ * @par Algorithm
+ *      Initializes rootNode to NULL
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BTreeClass<DataType>::BTreeClass
+   (
+    // no parameters
+   )
+       : rootNode( NULL )
+{
+    // Initializer used
+}
+
+/**
+ * @brief Copy BTreeClass constructor
+ *
+ * @details Constructs BTreeClass as copy of input
+ *
+ * @pre assumes Uninitialized BTreeClass object
+ *
+ * @post BTreeClass object is initialized as copy
+ *
+ * @par Algorithm
+ *      Calls copyTree method
+ *
+ * @exception None
+ *
+ * @param [in] copied
+ *             BTreeClass object to be copied
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BTreeClass<DataType>::BTreeClass
+   (
+    const BTreeClass<DataType> &copied     // input: object to be copied
+   )
+       : rootNode( NULL )
+{
+    copyTree( rootNode, copied.rootNode );
+}
+
+/**
+ * @brief BTreeClass destructor
+ *
+ * @details Destructs BTreeClass object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post BTreeClass object is freed
+ *
+ * @par Algorithm
+ *      Calls clear method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+BTreeClass<DataType>::~BTreeClass
+   (
+    // no parameters
+   )
+{
+    clear();
+}
+
+/**
+ * @brief BTreeClass assignment operator
+ *
+ * @details Assigns BTreeClass as copy of input
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post BTreeClass object is a copy
+ *
+ * @par Algorithm
+ *      Calls copyTree method after clearing
+ *
+ * @exception None
+ *
+ * @param [in] rhData
+ *             BTreeClass object to be copied
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+const BTreeClass<DataType>& BTreeClass<DataType>::operator =
+   (
+    const BTreeClass<DataType> &rhData     // input: object to be copied
+   )
+{
+    if( this != &rhData )
+    {
+        clear();
+        copyTree( rootNode, rhData.rootNode );
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Clear method
+ *
+ * @details Clears all data in object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post BTreeClass object is empty
+ *
+ * @par Algorithm
+ *      Calls clearHelper method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::clear
+   (
+    // no parameters
+   )
+{
+    clearHelper( rootNode );
+    rootNode = NULL;
+}
+
+/**
+ * @brief Insert method
+ *
+ * @details Inserts data in object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post newData is inserted into object
+ *
+ * @par Algorithm
+ *      Single pass down the tree, splitting every full node met
+ *      so a leaf always has room, stopping early on a duplicate
+ *
+ * @exception None
+ *
+ * @param [in] newData
+ *             Data to be inserted
+ *
+ * @return None
+ *
+ * @note Duplicates are dropped
+ */
+template <class DataType>
+void BTreeClass<DataType>::insert
+   (
+    const DataType &newData     // input: data to be inserted
+   )
+{
+    BTreeNode<DataType> *workingPtr, *newRoot;
+    int position, index, difference;
+    bool found;
+
+    if( rootNode == NULL )
+    {
+        rootNode = new BTreeNode<DataType>( true );
+        rootNode->keys[ 0 ] = newData;
+        rootNode->keyCount = 1;
+
+        return;
+    }
+
+    if( rootNode->keyCount == MAX_KEYS )
+    {
+        newRoot = new BTreeNode<DataType>( false );
+        newRoot->children[ 0 ] = rootNode;
+        rootNode = newRoot;
+
+        splitChild( rootNode, 0 );
+    }
+
+    workingPtr = rootNode;
+
+    while( true )
+    {
+        position = findPosition( workingPtr, newData, found );
+
+        if( found )
+        {
+            return;
+        }
+
+        if( workingPtr->leaf )
+        {
+            for( index = workingPtr->keyCount; index > position; index-- )
+            {
+                workingPtr->keys[ index ] = workingPtr->keys[ index - 1 ];
+            }
+
+            workingPtr->keys[ position ] = newData;
+            workingPtr->keyCount++;
+
+            return;
+        }
+
+        if( workingPtr->children[ position ]->keyCount == MAX_KEYS )
+        {
+            splitChild( workingPtr, position );
+
+            difference = newData.compareTo( workingPtr->keys[ position ] );
+
+            if( difference == 0 )
+            {
+                return;
+            }
+
+            else if( difference > 0 )
+            {
+                position++;
+            }
+        }
+
+        workingPtr = workingPtr->children[ position ];
+    }
+}
+
+/**
+ * @brief Find method
+ *
+ * @details Finds data in object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Know if data exists in tree
+ *
+ * @par Algorithm
+ *      Binary searches each node on the path down the tree
+ *
+ * @exception None
+ *
+ * @param [in] searchDataItem
+ *             Data to be searched for
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BTreeClass<DataType>::find
+   (
+    DataType &searchDataItem     // input: data to be searched for
+   ) const
+{
+    BTreeNode<DataType> *workingPtr = rootNode;
+    int position;
+    bool found;
+
+    while( workingPtr != NULL )
+    {
+        position = findPosition( workingPtr, searchDataItem, found );
+
+        if( found )
+        {
+            return true;
+        }
+
+        workingPtr = workingPtr->children[ position ];
+    }
+
+    return false;
+}
+
+/**
+ * @brief Remove method
+ *
+ * @details Removes data from object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data is removed from tree
+ *
+ * @par Algorithm
+ *      Calls removeHelper method, then shrinks tree if root emptied
+ *
+ * @exception None
+ *
+ * @param [in] dataItem
+ *             Data to be removed
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BTreeClass<DataType>::remove
+   (
+    const DataType &dataItem     // input: data to be removed
+   )
+{
+    BTreeNode<DataType> *oldRoot;
+    bool result;
+
+    if( isEmpty() )
+    {
+        return false;
+    }
+
+    result = removeHelper( rootNode, dataItem );
+
+    if( rootNode->keyCount == 0 )
+    {
+        oldRoot = rootNode;
+
+        if( rootNode->leaf )
+        {
+            rootNode = NULL;
+        }
+
+        else
+        {
+            rootNode = rootNode->children[ 0 ];
+        }
+
+        delete oldRoot;
+    }
+
+    return result;
+}
+
+/**
+ * @brief isEmpty method
+ *
+ * @details Checks if object is empty
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Know if tree is empty
+ *
+ * @par Algorithm
+ *      Checks if rootNode is NULL
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if empty
+ *
+ * @note None
+ */
+template <class DataType>
+bool BTreeClass<DataType>::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    return ( rootNode == NULL );
+}
+
+/**
+ * @brief Preorder Traversal
+ *
+ * @details Outputs list in pre-order, all keys of a node before
+ *          its children
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Calls preOrderTraversalHelper method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::preOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    if( isEmpty() )
+    {
+        cout << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        preOrderTraversalHelper( rootNode );
+        cout << endl;
+    }
+}
+
+/**
+ * @brief Inorder Traversal
+ *
+ * @details Outputs list in order
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Calls inOrderTraversalHelper method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::inOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    if( isEmpty() )
+    {
+        cout << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        inOrderTraversalHelper( rootNode );
+        cout << endl;
+    }
+}
+
+/**
+ * @brief Postorder Traversal
+ *
+ * @details Outputs list in post-order, all children of a node before
+ *          its keys
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Calls postOrderTraversalHelper method
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::postOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    if( isEmpty() )
+    {
+        cout << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        postOrderTraversalHelper( rootNode );
+        cout << endl;
+    }
+}
+
+/**
+ * @brief show tree structure
+ *
+ * @details Displays structure of tree, one line per level
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Level order walk, printing each node's keys in brackets
+ *
+ * @exception None
+ *
+ * @param [in] ID
+ *             char to denote ID of tree being displayed
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::showBSTStructure
+   (
+    char ID     // input: id of tree to show
+   )
+{
+    vector<BTreeNode<DataType> *> thisLevel, nextLevel;
+    char string[ STD_STR_LEN ];
+    size_t nodeIndex;
+    int keyIndex;
+
+    cout << "BST ID " << ID << ":" << endl;
+
+    if( rootNode != NULL )
+    {
+        thisLevel.push_back( rootNode );
+    }
+
+    while( !thisLevel.empty() )
+    {
+        nextLevel.clear();
+
+        for( nodeIndex = 0; nodeIndex < thisLevel.size(); nodeIndex++ )
+        {
+            cout << '[';
+
+            for( keyIndex = 0; keyIndex < thisLevel[ nodeIndex ]->keyCount;
+                                                                 keyIndex++ )
+            {
+                thisLevel[ nodeIndex ]->keys[ keyIndex ].toString( string );
+
+                if( keyIndex > 0 )
+                {
+                    cout << ' ';
+                }
+
+                cout << string;
+            }
+
+            cout << "] ";
+
+            if( !thisLevel[ nodeIndex ]->leaf )
+            {
+                for( keyIndex = 0; keyIndex <= thisLevel[ nodeIndex ]->keyCount;
+                                                                 keyIndex++ )
+                {
+                    nextLevel.push_back(
+                                thisLevel[ nodeIndex ]->children[ keyIndex ] );
+                }
+            }
+        }
+
+        cout << endl;
+
+        thisLevel.swap( nextLevel );
+    }
+
+    cout << endl;
+}
+
+/**
+ * @brief BTreeClass copy method
+ *
+ * @details Assigns BTreeClass as copy of input
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post BTreeClass object is a copy
+ *
+ * @par Algorithm
+ *      Moves down through tree, creating new nodes and
+ *      copying keys from parameter tree
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be copied into
+ *
+ * @param [in] sourcePtr
+ *             node to be copied from
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::copyTree
+   (
+    BTreeNode<DataType> *&workingPtr,        // input: tree to be assigned
+    const BTreeNode<DataType> *sourcePtr     // input: tree to be copied
+   )
+{
+    int index;
+
+    if( sourcePtr != NULL )
+    {
+        workingPtr = new BTreeNode<DataType>( sourcePtr->leaf );
+        workingPtr->keyCount = sourcePtr->keyCount;
+
+        for( index = 0; index < sourcePtr->keyCount; index++ )
+        {
+            workingPtr->keys[ index ] = sourcePtr->keys[ index ];
+        }
+
+        if( !sourcePtr->leaf )
+        {
+            for( index = 0; index <= sourcePtr->keyCount; index++ )
+            {
+                copyTree( workingPtr->children[ index ],
+                                                 sourcePtr->children[ index ] );
+            }
+        }
+    }
+}
+
+/**
+ * @brief Clear helper method
+ *
+ * @details Clears all data in object
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post BTreeClass object is empty
+ *
+ * @par Algorithm
+ *      Recurses through nodes, freeing memory
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be cleared
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::clearHelper
+   (
+    BTreeNode<DataType> *workingPtr     // input: node to be freed
+   )
+{
+    int index;
+
+    if( workingPtr != NULL )
+    {
+        if( !workingPtr->leaf )
+        {
+            for( index = 0; index <= workingPtr->keyCount; index++ )
+            {
+                clearHelper( workingPtr->children[ index ] );
+            }
+        }
+
+        delete workingPtr;
+    }
+}
+
+/**
+ * @brief Find position helper
+ *
+ * @details Locates key within one node
+ *
+ * @pre assumes node is not NULL
+ *
+ * @post found tells if key is stored in node
+ *
+ * @par Algorithm
+ *      Binary search for the first key not less than keyItem,
+ *      one comparison per probe
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be searched
+ *
+ * @param [in] keyItem
+ *             key to be located
+ *
+ * @param [out] found
+ *              true if key at returned position equals keyItem
+ *
+ * @return Index of first key not less than keyItem, which is also
+ *         the child to descend into when not found
+ *
+ * @note None
+ */
+template <class DataType>
+int BTreeClass<DataType>::findPosition
+   (
+    const BTreeNode<DataType> *workingPtr,     // input: node to search
+    const DataType &keyItem,                   // input: key to locate
+    bool &found                                // output: key found flag
+   ) const
+{
+    int low = 0, high = workingPtr->keyCount, middle, difference;
+
+    found = false;
+
+    while( low < high )
+    {
+        middle = ( low + high ) / 2;
+
+        difference = keyItem.compareTo( workingPtr->keys[ middle ] );
+
+        if( difference == 0 )
+        {
+            found = true;
+
+            return middle;
+        }
+
+        else if( difference < 0 )
+        {
+            high = middle;
+        }
+
+        else
+        {
+            low = middle + 1;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * @brief Split child helper
+ *
+ * @details Splits a full child around its median key
+ *
+ * @pre assumes parent is not full and child at childIndex is full
+ *
+ * @post Median key moved up into parent, child split in two
+ *
+ * @par Algorithm
+ *      Upper half of keys and children move to a new sibling,
+ *      parent keys and children shift right to make room
+ *
+ * @exception None
+ *
+ * @param [in] parentPtr
+ *             parent of node to split
+ *
+ * @param [in] childIndex
+ *             index of full child
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::splitChild
+   (
+    BTreeNode<DataType> *parentPtr,     // input: parent node
+    int childIndex                      // input: index of full child
+   )
+{
+    BTreeNode<DataType> *fullPtr = parentPtr->children[ childIndex ];
+    BTreeNode<DataType> *siblingPtr = new BTreeNode<DataType>( fullPtr->leaf );
+    int index;
+
+    siblingPtr->keyCount = MIN_DEGREE - 1;
+
+    for( index = 0; index < MIN_DEGREE - 1; index++ )
+    {
+        siblingPtr->keys[ index ] = fullPtr->keys[ index + MIN_DEGREE ];
+    }
+
+    if( !fullPtr->leaf )
+    {
+        for( index = 0; index < MIN_DEGREE; index++ )
+        {
+            siblingPtr->children[ index ]
+                                  = fullPtr->children[ index + MIN_DEGREE ];
+            fullPtr->children[ index + MIN_DEGREE ] = NULL;
+        }
+    }
+
+    fullPtr->keyCount = MIN_DEGREE - 1;
+
+    for( index = parentPtr->keyCount; index > childIndex; index-- )
+    {
+        parentPtr->children[ index + 1 ] = parentPtr->children[ index ];
+        parentPtr->keys[ index ] = parentPtr->keys[ index - 1 ];
+    }
+
+    parentPtr->children[ childIndex + 1 ] = siblingPtr;
+    parentPtr->keys[ childIndex ] = fullPtr->keys[ MIN_DEGREE - 1 ];
+    parentPtr->keyCount++;
+}
+
+/**
+ * @brief Remove helper method
+ *
+ * @details Removes data from subtree
+ *
+ * @pre assumes node holds at least MIN_DEGREE keys unless it is the root
+ *
+ * @post Data is removed from subtree
+ *
+ * @par Algorithm
+ *      Single pass down the tree; before descending into a child
+ *      with the minimum key count, borrows from a sibling or merges
+ *      so the key can always be removed without backing up
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be checked
+ *
+ * @param [in] removeDataItem
+ *             Data to be removed
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool BTreeClass<DataType>::removeHelper
+   (
+    BTreeNode<DataType> *workingPtr,   // input: node to be checked
+    const DataType &removeDataItem     // input: data to be removed
+   )
+{
+    int position, index;
+    bool found, lastChild;
+
+    position = findPosition( workingPtr, removeDataItem, found );
+
+    if( found )
+    {
+        if( workingPtr->leaf )
+        {
+            for( index = position + 1; index < workingPtr->keyCount; index++ )
+            {
+                workingPtr->keys[ index - 1 ] = workingPtr->keys[ index ];
+            }
+
+            workingPtr->keyCount--;
+        }
+
+        else
+        {
+            removeFromInternal( workingPtr, position );
+        }
+
+        return true;
+    }
+
+    if( workingPtr->leaf )
+    {
+        return false;
+    }
+
+    lastChild = ( position == workingPtr->keyCount );
+
+    if( workingPtr->children[ position ]->keyCount < MIN_DEGREE )
+    {
+        fillChild( workingPtr, position );
+    }
+
+    // a merge of the last child moves its keys into the previous child
+    if( lastChild && position > workingPtr->keyCount )
+    {
+        return removeHelper( workingPtr->children[ position - 1 ],
+                                                           removeDataItem );
+    }
+
+    return removeHelper( workingPtr->children[ position ], removeDataItem );
+}
+
+/**
+ * @brief Remove from internal node helper
+ *
+ * @details Removes key stored in an internal node
+ *
+ * @pre assumes key at keyIndex exists in internal node
+ *
+ * @post Key is removed from subtree
+ *
+ * @par Algorithm
+ *      Replaces key with its predecessor or successor when that child
+ *      can spare a key, otherwise merges both children around the key
+ *      and removes it from the merged node
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             internal node holding key
+ *
+ * @param [in] keyIndex
+ *             index of key to remove
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::removeFromInternal
+   (
+    BTreeNode<DataType> *workingPtr,   // input: internal node
+    int keyIndex                       // input: index of key to remove
+   )
+{
+    BTreeNode<DataType> *leftPtr = workingPtr->children[ keyIndex ];
+    BTreeNode<DataType> *rightPtr = workingPtr->children[ keyIndex + 1 ];
+    BTreeNode<DataType> *tmp;
+    DataType mergedKey;
+
+    if( leftPtr->keyCount >= MIN_DEGREE )
+    {
+        tmp = leftPtr;
+
+        while( !tmp->leaf )
+        {
+            tmp = tmp->children[ tmp->keyCount ];
+        }
+
+        workingPtr->keys[ keyIndex ] = tmp->keys[ tmp->keyCount - 1 ];
+        removeHelper( leftPtr, workingPtr->keys[ keyIndex ] );
+    }
+
+    else if( rightPtr->keyCount >= MIN_DEGREE )
+    {
+        tmp = rightPtr;
+
+        while( !tmp->leaf )
+        {
+            tmp = tmp->children[ 0 ];
+        }
+
+        workingPtr->keys[ keyIndex ] = tmp->keys[ 0 ];
+        removeHelper( rightPtr, workingPtr->keys[ keyIndex ] );
+    }
+
+    else
+    {
+        // key moves into the merged child, which may shift it again
+        mergedKey = workingPtr->keys[ keyIndex ];
+
+        mergeChildren( workingPtr, keyIndex );
+        removeHelper( leftPtr, mergedKey );
+    }
+}
+
+/**
+ * @brief Fill child helper
+ *
+ * @details Gives a minimal child an extra key
+ *
+ * @pre assumes child at childIndex holds MIN_DEGREE - 1 keys
+ *
+ * @post Child, or the node it merged into, holds at least MIN_DEGREE keys
+ *
+ * @par Algorithm
+ *      Borrows from the left or right sibling if either can spare a key,
+ *      otherwise merges with a sibling
+ *
+ * @exception None
+ *
+ * @param [in] parentPtr
+ *             parent node
+ *
+ * @param [in] childIndex
+ *             index of child to fill
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::fillChild
+   (
+    BTreeNode<DataType> *parentPtr,     // input: parent node
+    int childIndex                      // input: index of child to fill
+   )
+{
+    if( childIndex != 0
+          && parentPtr->children[ childIndex - 1 ]->keyCount >= MIN_DEGREE )
+    {
+        borrowFromPrev( parentPtr, childIndex );
+    }
+
+    else if( childIndex != parentPtr->keyCount
+          && parentPtr->children[ childIndex + 1 ]->keyCount >= MIN_DEGREE )
+    {
+        borrowFromNext( parentPtr, childIndex );
+    }
+
+    else if( childIndex != parentPtr->keyCount )
+    {
+        mergeChildren( parentPtr, childIndex );
+    }
+
+    else
+    {
+        mergeChildren( parentPtr, childIndex - 1 );
+    }
+}
+
+/**
+ * @brief Borrow from previous sibling helper
+ *
+ * @details Rotates a key from the left sibling through the parent
+ *
+ * @pre assumes left sibling holds at least MIN_DEGREE keys
+ *
+ * @post Child gained one key, left sibling lost one
+ *
+ * @par Algorithm
+ *      Parent separator moves down to front of child,
+ *      last key of sibling moves up, last child pointer moves across
+ *
+ * @exception None
+ *
+ * @param [in] parentPtr
+ *             parent node
+ *
+ * @param [in] childIndex
+ *             index of child to fill
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::borrowFromPrev
+   (
+    BTreeNode<DataType> *parentPtr,     // input: parent node
+    int childIndex                      // input: index of child to fill
+   )
+{
+    BTreeNode<DataType> *childPtr = parentPtr->children[ childIndex ];
+    BTreeNode<DataType> *siblingPtr = parentPtr->children[ childIndex - 1 ];
+    int index;
+
+    for( index = childPtr->keyCount - 1; index >= 0; index-- )
+    {
+        childPtr->keys[ index + 1 ] = childPtr->keys[ index ];
+    }
+
+    if( !childPtr->leaf )
+    {
+        for( index = childPtr->keyCount; index >= 0; index-- )
+        {
+            childPtr->children[ index + 1 ] = childPtr->children[ index ];
+        }
+
+        childPtr->children[ 0 ] = siblingPtr->children[ siblingPtr->keyCount ];
+        siblingPtr->children[ siblingPtr->keyCount ] = NULL;
+    }
+
+    childPtr->keys[ 0 ] = parentPtr->keys[ childIndex - 1 ];
+    parentPtr->keys[ childIndex - 1 ]
+                                  = siblingPtr->keys[ siblingPtr->keyCount - 1 ];
+
+    childPtr->keyCount++;
+    siblingPtr->keyCount--;
+}
+
+/**
+ * @brief Borrow from next sibling helper
+ *
+ * @details Rotates a key from the right sibling through the parent
+ *
+ * @pre assumes right sibling holds at least MIN_DEGREE keys
+ *
+ * @post Child gained one key, right sibling lost one
+ *
+ * @par Algorithm
+ *      Parent separator moves down to end of child,
+ *      first key of sibling moves up, first child pointer moves across
+ *
+ * @exception None
+ *
+ * @param [in] parentPtr
+ *             parent node
+ *
+ * @param [in] childIndex
+ *             index of child to fill
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::borrowFromNext
+   (
+    BTreeNode<DataType> *parentPtr,     // input: parent node
+    int childIndex                      // input: index of child to fill
+   )
+{
+    BTreeNode<DataType> *childPtr = parentPtr->children[ childIndex ];
+    BTreeNode<DataType> *siblingPtr = parentPtr->children[ childIndex + 1 ];
+    int index;
+
+    childPtr->keys[ childPtr->keyCount ] = parentPtr->keys[ childIndex ];
+
+    if( !childPtr->leaf )
+    {
+        childPtr->children[ childPtr->keyCount + 1 ] = siblingPtr->children[ 0 ];
+    }
+
+    parentPtr->keys[ childIndex ] = siblingPtr->keys[ 0 ];
+
+    for( index = 1; index < siblingPtr->keyCount; index++ )
+    {
+        siblingPtr->keys[ index - 1 ] = siblingPtr->keys[ index ];
+    }
+
+    if( !siblingPtr->leaf )
+    {
+        for( index = 1; index <= siblingPtr->keyCount; index++ )
+        {
+            siblingPtr->children[ index - 1 ] = siblingPtr->children[ index ];
+        }
+
+        siblingPtr->children[ siblingPtr->keyCount ] = NULL;
+    }
+
+    childPtr->keyCount++;
+    siblingPtr->keyCount--;
+}
+
+/**
+ * @brief Merge children helper
+ *
+ * @details Merges two minimal children around their separator key
+ *
+ * @pre assumes both children of key hold MIN_DEGREE - 1 keys
+ *
+ * @post Left child holds MAX_KEYS keys, right child is freed
+ *
+ * @par Algorithm
+ *      Separator and all of right child move into left child,
+ *      parent keys and children shift left to close the gap
+ *
+ * @exception None
+ *
+ * @param [in] parentPtr
+ *             parent node
+ *
+ * @param [in] keyIndex
+ *             index of separator key
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::mergeChildren
+   (
+    BTreeNode<DataType> *parentPtr,     // input: parent node
+    int keyIndex                        // input: index of separator key
+   )
+{
+    BTreeNode<DataType> *childPtr = parentPtr->children[ keyIndex ];
+    BTreeNode<DataType> *siblingPtr = parentPtr->children[ keyIndex + 1 ];
+    int index;
+
+    childPtr->keys[ MIN_DEGREE - 1 ] = parentPtr->keys[ keyIndex ];
+
+    for( index = 0; index < siblingPtr->keyCount; index++ )
+    {
+        childPtr->keys[ index + MIN_DEGREE ] = siblingPtr->keys[ index ];
+    }
+
+    if( !childPtr->leaf )
+    {
+        for( index = 0; index <= siblingPtr->keyCount; index++ )
+        {
+            childPtr->children[ index + MIN_DEGREE ]
+                                              = siblingPtr->children[ index ];
+        }
+    }
+
+    for( index = keyIndex + 1; index < parentPtr->keyCount; index++ )
+    {
+        parentPtr->keys[ index - 1 ] = parentPtr->keys[ index ];
+        parentPtr->children[ index ] = parentPtr->children[ index + 1 ];
+    }
+
+    parentPtr->children[ parentPtr->keyCount ] = NULL;
+
+    childPtr->keyCount += siblingPtr->keyCount + 1;
+    parentPtr->keyCount--;
+
+    delete siblingPtr;
+}
+
+/**
+ * @brief Preorder Traversal helper
+ *
+ * @details Outputs list in pre-order
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Outputs keys of node, then recurses on each child
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be output and recursed on
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::preOrderTraversalHelper
+   (
+    BTreeNode<DataType> *workingPtr     // input: node to be output
+   ) const
+{
+    char string[ STD_STR_LEN ];
+    int index;
+
+    if( workingPtr != NULL )
+    {
+        for( index = 0; index < workingPtr->keyCount; index++ )
+        {
+            workingPtr->keys[ index ].toString( string );
+            cout << string << endl;
+        }
+
+        if( !workingPtr->leaf )
+        {
+            for( index = 0; index <= workingPtr->keyCount; index++ )
+            {
+                preOrderTraversalHelper( workingPtr->children[ index ] );
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inorder Traversal helper
+ *
+ * @details Outputs list in order
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Alternates recursing on children and outputting keys
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be output and recursed on
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::inOrderTraversalHelper
+   (
+    BTreeNode<DataType> *workingPtr     // input: node to be output
+   ) const
+{
+    char string[ STD_STR_LEN ];
+    int index;
+
+    if( workingPtr != NULL )
+    {
+        for( index = 0; index < workingPtr->keyCount; index++ )
+        {
+            inOrderTraversalHelper( workingPtr->children[ index ] );
+
+            workingPtr->keys[ index ].toString( string );
+            cout << string << endl;
+        }
+
+        inOrderTraversalHelper( workingPtr->children[ workingPtr->keyCount ] );
+    }
+}
+
+/**
+ * @brief Postorder Traversal helper
+ *
+ * @details Outputs list in post-order
+ *
+ * @pre assumes Initialized BTreeClass object
+ *
+ * @post Data in tree has been output to screen
+ *
+ * @par Algorithm
+ *      Recurses on each child, then outputs keys of node
+ *
+ * @exception None
+ *
+ * @param [in] workingPtr
+ *             node to be output and recursed on
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void BTreeClass<DataType>::postOrderTraversalHelper
+   (
+    BTreeNode<DataType> *workingPtr     // input: node to be output
+   ) const
+{
+    char string[ STD_STR_LEN ];
+    int index;
+
+    if( workingPtr != NULL )
+    {
+        if( !workingPtr->leaf )
+        {
+            for( index = 0; index <= workingPtr->keyCount; index++ )
+            {
+                postOrderTraversalHelper( workingPtr->children[ index ] );
+            }
+        }
+
+        for( index = 0; index < workingPtr->keyCount; index++ )
+        {
+            workingPtr->keys[ index ].toString( string );
+            cout << string << endl;
+        }
+    }
+}
+
+#endif  // define BTREE_CLASS_CPP
+
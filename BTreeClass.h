@@ -0,0 +1,127 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file BTreeClass.h
+ *
+ * @brief Definition file for BTreeClass
+ *
+ * @details Specifies all member methods of the BTreeClass,
+ *          a B-tree with the same public interface as BSTClass
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef BTREE_CLASS_H
+#define BTREE_CLASS_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+template <typename DataType>
+class BTreeNode
+   {
+    public:
+
+       // constants
+       static const int CACHE_LINE_SIZE = 64;
+       static const int NODE_LINES = 16;
+       static const int FIT_KEYS = ( CACHE_LINE_SIZE * NODE_LINES )
+                                                        / sizeof( DataType );
+
+       // minimum degree, every node but the root holds at least
+       // MIN_DEGREE - 1 and at most MAX_KEYS keys
+       static const int MIN_DEGREE = ( FIT_KEYS + 1 ) / 2 > 2
+                                               ? ( FIT_KEYS + 1 ) / 2 : 2;
+       static const int MAX_KEYS = 2 * MIN_DEGREE - 1;
+
+       BTreeNode( bool isLeaf );
+
+       int keyCount;
+       bool leaf;
+
+       DataType keys[ MAX_KEYS ];
+       BTreeNode<DataType> *children[ MAX_KEYS + 1 ];
+   };
+
+template <typename DataType>
+class BTreeClass
+   {
+    public:
+
+       // constants
+       static const int STD_STR_LEN = 50;
+       static const int MIN_DEGREE = BTreeNode<DataType>::MIN_DEGREE;
+       static const int MAX_KEYS = BTreeNode<DataType>::MAX_KEYS;
+
+       // constructor
+       BTreeClass();
+       BTreeClass( const BTreeClass<DataType> &copied );
+
+       // destructor
+       ~BTreeClass();
+
+       // assignment operator
+       const BTreeClass &operator = (const BTreeClass<DataType> &rhData );
+
+       // modifiers
+       void clear();
+       void insert( const DataType &newData );
+       bool find( DataType &searchDataItem ) const;
+       bool remove( const DataType &dataItem );
+
+       // accessors
+       bool isEmpty() const;
+       void preOrderTraversal() const;
+       void inOrderTraversal() const;
+       void postOrderTraversal() const;
+       void showBSTStructure( char ID );
+
+    private:
+
+       void copyTree( BTreeNode<DataType> *&workingPtr,
+                                       const BTreeNode<DataType> *sourcePtr );
+
+       void clearHelper( BTreeNode<DataType> *workingPtr );
+
+       int findPosition( const BTreeNode<DataType> *workingPtr,
+                                  const DataType &keyItem, bool &found ) const;
+
+       void splitChild( BTreeNode<DataType> *parentPtr, int childIndex );
+
+       bool removeHelper( BTreeNode<DataType> *workingPtr,
+                                           const DataType &removeDataItem );
+
+       void removeFromInternal( BTreeNode<DataType> *workingPtr,
+                                                              int keyIndex );
+
+       void fillChild( BTreeNode<DataType> *parentPtr, int childIndex );
+
+       void borrowFromPrev( BTreeNode<DataType> *parentPtr, int childIndex );
+
+       void borrowFromNext( BTreeNode<DataType> *parentPtr, int childIndex );
+
+       void mergeChildren( BTreeNode<DataType> *parentPtr, int keyIndex );
+
+       void preOrderTraversalHelper( BTreeNode<DataType> *workingPtr) const;
+
+       void inOrderTraversalHelper( BTreeNode<DataType> *workingPtr) const;
+
+       void postOrderTraversalHelper( BTreeNode<DataType> *workingPtr) const;
+
+       BTreeNode<DataType> *rootNode;
+   };
+
+#endif	// define BTREE_CLASS_H
+
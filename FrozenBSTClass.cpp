@@ -0,0 +1,580 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file FrozenBSTClass.cpp
+ *
+ * @brief Implementation file for FrozenBSTClass
+ *
+ * @details Implements all member methods of the FrozenBSTClass
+ *          and its iterator
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef FROZEN_BST_CLASS_CPP
+#define FROZEN_BST_CLASS_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include "FrozenBSTClass.h"
+
+using namespace std;
+
+static const int PREFETCH_LEVELS = 2;
+static const int PREFETCH_WIDTH = 1 << PREFETCH_LEVELS;
+
+/**
+ * @brief Initialization FrozenBSTIterator constructor
+ *
+ * @details Constructs iterator at given slot
+ *
+ * @pre assumes Uninitialized FrozenBSTIterator object
+ *
+ * @post Iterator refers to slot of key array, 0 is the end position
+ *
+ * @par Algorithm
+ *      Calls initializers on member data
+ *
+ * @exception None
+ *
+ * @param [in] keyArray
+ *             Eytzinger ordered keys being iterated
+ *
+ * @param [in] startSlot
+ *             slot of first item, 0 for end
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+FrozenBSTIterator<DataType>::FrozenBSTIterator
+   (
+    const vector<DataType> &keyArray,     // input: keys being iterated
+    int startSlot                         // input: starting slot
+   )
+       : keys( &keyArray ),
+         slot( startSlot )
+{
+    // Initializers used
+}
+
+/**
+ * @brief Dereference operator
+ *
+ * @details Gives current item
+ *
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Returns key at current slot
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType &FrozenBSTIterator<DataType>::operator *
+   (
+    // no parameters
+   ) const
+{
+    return (*keys)[ slot ];
+}
+
+/**
+ * @brief Member access operator
+ *
+ * @details Gives address of current item
+ *
+ * @pre assumes iterator is not at end
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Returns address of key at current slot
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Pointer to current item
+ *
+ * @note None
+ */
+template <class DataType>
+const DataType *FrozenBSTIterator<DataType>::operator ->
+   (
+    // no parameters
+   ) const
+{
+    return &(*keys)[ slot ];
+}
+
+/**
+ * @brief Increment operator
+ *
+ * @details Moves to in-order successor
+ *
+ * @pre assumes iterator is not at end
+ *
+ * @post Iterator refers to next item or end
+ *
+ * @par Algorithm
+ *      With a right child, moves right then as far left as possible;
+ *      otherwise climbs while the slot is a right child, then once more
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Reference to this iterator
+ *
+ * @note None
+ */
+template <class DataType>
+FrozenBSTIterator<DataType> &FrozenBSTIterator<DataType>::operator ++
+   (
+    // no parameters
+   )
+{
+    int lastSlot = int( keys->size() ) - 1;
+
+    if( 2 * slot + 1 <= lastSlot )
+    {
+        slot = 2 * slot + 1;
+
+        while( 2 * slot <= lastSlot )
+        {
+            slot = 2 * slot;
+        }
+    }
+
+    else
+    {
+        while( slot & 1 )
+        {
+            slot >>= 1;
+        }
+
+        slot >>= 1;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Equality operator
+ *
+ * @details Compares iterator positions
+ *
+ * @pre assumes both iterators belong to the same snapshot
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Compares slots
+ *
+ * @exception None
+ *
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if same position
+ *
+ * @note None
+ */
+template <class DataType>
+bool FrozenBSTIterator<DataType>::operator ==
+   (
+    const FrozenBSTIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    return slot == other.slot;
+}
+
+/**
+ * @brief Inequality operator
+ *
+ * @details Compares iterator positions
+ *
+ * @pre assumes both iterators belong to the same snapshot
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Compares slots
+ *
+ * @exception None
+ *
+ * @param [in] other
+ *             iterator to compare with
+ *
+ * @return Bool with true if different position
+ *
+ * @note None
+ */
+template <class DataType>
+bool FrozenBSTIterator<DataType>::operator !=
+   (
+    const FrozenBSTIterator<DataType> &other     // input: other iterator
+   ) const
+{
+    return slot != other.slot;
+}
+
+/**
+ * @brief FrozenBSTClass default constructor
+ *
+ * @details Constructs empty snapshot
+ *
+ * @pre assumes Uninitialized FrozenBSTClass object
+ *
+ * @post Empty FrozenBSTClass object is initialized
+ *
+ * @par Algorithm
+ *      Reserves unused slot 0
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+FrozenBSTClass<DataType>::FrozenBSTClass
+   (
+    // no parameters
+   )
+       : keys( 1 ),
+         itemCount( 0 )
+{
+    // Initializers used
+}
+
+/**
+ * @brief Sorted items FrozenBSTClass constructor
+ *
+ * @details Constructs snapshot from items in sorted order
+ *
+ * @pre assumes items are sorted and free of duplicates
+ *
+ * @post Items are stored in Eytzinger order
+ *
+ * @par Algorithm
+ *      Sizes key array once, then calls buildHelper
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] sortedItems
+ *             items in ascending order
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+FrozenBSTClass<DataType>::FrozenBSTClass
+   (
+    const vector<DataType> &sortedItems     // input: items in order
+   )
+       : keys( sortedItems.size() + 1 ),
+         itemCount( int( sortedItems.size() ) )
+{
+    buildHelper( sortedItems, 0, 1 );
+}
+
+/**
+ * @brief Find method
+ *
+ * @details Finds data in snapshot
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post Know if data exists in snapshot
+ *
+ * @par Algorithm
+ *      Descends the implicit tree with the comparison result added to
+ *      the child index instead of branching, prefetching the slots
+ *      PREFETCH_LEVELS below; the lower bound is recovered from the
+ *      final slot by removing the trailing right turns
+ *
+ * @exception None
+ *
+ * @param [in] searchDataItem
+ *             Data to be searched for
+ *
+ * @return Bool with true for success
+ *
+ * @note None
+ */
+template <class DataType>
+bool FrozenBSTClass<DataType>::find
+   (
+    DataType &searchDataItem     // input: data to be searched for
+   ) const
+{
+    const DataType *keyArray = &keys[ 0 ];
+    int slot = 1, prefetchSlot, index;
+
+    while( slot <= itemCount )
+    {
+        prefetchSlot = slot * PREFETCH_WIDTH;
+
+        if( prefetchSlot + PREFETCH_WIDTH - 1 <= itemCount )
+        {
+            for( index = 0; index < PREFETCH_WIDTH; index++ )
+            {
+                __builtin_prefetch( keyArray + prefetchSlot + index );
+            }
+        }
+
+        slot = 2 * slot
+                   + ( searchDataItem.compareTo( keyArray[ slot ] ) > 0 );
+    }
+
+    // strip the right turns taken after the last left turn
+    slot >>= __builtin_ffs( ~slot );
+
+    return slot != 0 && searchDataItem.compareTo( keyArray[ slot ] ) == 0;
+}
+
+/**
+ * @brief isEmpty method
+ *
+ * @details Checks if snapshot is empty
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post Know if snapshot is empty
+ *
+ * @par Algorithm
+ *      Checks item count
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if empty
+ *
+ * @note None
+ */
+template <class DataType>
+bool FrozenBSTClass<DataType>::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    return itemCount == 0;
+}
+
+/**
+ * @brief size method
+ *
+ * @details Gives number of items in snapshot
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Returns item count
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Number of items
+ *
+ * @note None
+ */
+template <class DataType>
+int FrozenBSTClass<DataType>::size
+   (
+    // no parameters
+   ) const
+{
+    return itemCount;
+}
+
+/**
+ * @brief Inorder Traversal
+ *
+ * @details Outputs list in order
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post Data in snapshot has been output to screen
+ *
+ * @par Algorithm
+ *      Walks iterator from begin to end
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+void FrozenBSTClass<DataType>::inOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    char string[ STD_STR_LEN ];
+    const_iterator iter = begin();
+
+    if( isEmpty() )
+    {
+        cout << "Tree is empty" << endl;
+    }
+
+    else
+    {
+        for( ; iter != end(); ++iter )
+        {
+            iter->toString( string );
+            cout << string << endl;
+        }
+
+        cout << endl;
+    }
+}
+
+/**
+ * @brief begin method
+ *
+ * @details Gives iterator at smallest item
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Follows left children from the root
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Iterator at first item, or end if empty
+ *
+ * @note None
+ */
+template <class DataType>
+typename FrozenBSTClass<DataType>::const_iterator
+FrozenBSTClass<DataType>::begin
+   (
+    // no parameters
+   ) const
+{
+    int slot = 1;
+
+    if( isEmpty() )
+    {
+        return end();
+    }
+
+    while( 2 * slot <= itemCount )
+    {
+        slot = 2 * slot;
+    }
+
+    return const_iterator( keys, slot );
+}
+
+/**
+ * @brief end method
+ *
+ * @details Gives iterator past the largest item
+ *
+ * @pre assumes Initialized FrozenBSTClass object
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Uses unused slot 0 as end position
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return End iterator
+ *
+ * @note None
+ */
+template <class DataType>
+typename FrozenBSTClass<DataType>::const_iterator
+FrozenBSTClass<DataType>::end
+   (
+    // no parameters
+   ) const
+{
+    return const_iterator( keys, 0 );
+}
+
+/**
+ * @brief Build helper method
+ *
+ * @details Places sorted items into Eytzinger slots
+ *
+ * @pre assumes key array is sized for all items
+ *
+ * @post Subtree rooted at slot holds its share of sorted items
+ *
+ * @par Algorithm
+ *      In-order walk of the implicit tree, handing out sorted items
+ *      in sequence
+ *
+ * @exception None
+ *
+ * @param [in] sortedItems
+ *             items in ascending order
+ *
+ * @param [in] sortedIndex
+ *             index of next unplaced item
+ *
+ * @param [in] slot
+ *             implicit tree slot to fill
+ *
+ * @return Index of next unplaced item
+ *
+ * @note Recursion depth is the height of a complete tree, log N
+ */
+template <class DataType>
+int FrozenBSTClass<DataType>::buildHelper
+   (
+    const vector<DataType> &sortedItems,     // input: items in order
+    int sortedIndex,                         // input: next item to place
+    int slot                                 // input: slot to fill
+   )
+{
+    if( slot <= itemCount )
+    {
+        sortedIndex = buildHelper( sortedItems, sortedIndex, 2 * slot );
+
+        keys[ slot ] = sortedItems[ sortedIndex ];
+        sortedIndex++;
+
+        sortedIndex = buildHelper( sortedItems, sortedIndex, 2 * slot + 1 );
+    }
+
+    return sortedIndex;
+}
+
+#endif  // define FROZEN_BST_CLASS_CPP
+
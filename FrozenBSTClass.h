@@ -0,0 +1,91 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file FrozenBSTClass.h
+ *
+ * @brief Definition file for FrozenBSTClass
+ *
+ * @details Specifies all member methods of the FrozenBSTClass,
+ *          a read only snapshot of a BSTClass stored in Eytzinger
+ *          (breadth first) order in one array
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef FROZEN_BST_CLASS_H
+#define FROZEN_BST_CLASS_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+template <typename DataType>
+class FrozenBSTIterator
+   {
+    public:
+
+       FrozenBSTIterator( const vector<DataType> &keyArray, int startSlot );
+
+       const DataType &operator * () const;
+       const DataType *operator -> () const;
+       FrozenBSTIterator &operator ++ ();
+
+       bool operator == ( const FrozenBSTIterator<DataType> &other ) const;
+       bool operator != ( const FrozenBSTIterator<DataType> &other ) const;
+
+    private:
+
+       const vector<DataType> *keys;
+
+       int slot;
+   };
+
+template <typename DataType>
+class FrozenBSTClass
+   {
+    public:
+
+       // constants
+       static const int STD_STR_LEN = 50;
+
+       // iterator type
+       typedef FrozenBSTIterator<DataType> const_iterator;
+
+       // constructor
+       FrozenBSTClass();
+       explicit FrozenBSTClass( const vector<DataType> &sortedItems );
+
+       // accessors
+       bool find( DataType &searchDataItem ) const;
+       bool isEmpty() const;
+       int size() const;
+       void inOrderTraversal() const;
+
+       const_iterator begin() const;
+       const_iterator end() const;
+
+    private:
+
+       int buildHelper( const vector<DataType> &sortedItems,
+                                                 int sortedIndex, int slot );
+
+       // slot 0 is unused, children of slot k are 2k and 2k + 1
+       vector<DataType> keys;
+
+       int itemCount;
+   };
+
+#endif	// define FROZEN_BST_CLASS_H
+
@@ -15,22 +15,36 @@
  *          Michael Leverington (09 October 2015)
  *          Original code
  *
- * @Note Requires iostream.h, cstring, StudentType.h, BSTClass.cpp
+ * @Note Requires iostream.h, cstring, StudentType.h, BSTClass.cpp,
+ *       or BTreeClass.cpp when compiled with -DUSE_BTREE
  */
 
 // Precompiler directives /////////////////////////////////////////////////////
 
-   // None
+   // define USE_BTREE to run the tests on the B-tree backend
 
 // Header files ///////////////////////////////////////////////////////////////
 
 #include <iostream>
 #include <cstring>
 #include "StudentType.h"
+
+#ifdef USE_BTREE
+#include "BTreeClass.cpp"
+#else
 #include "BSTClass.cpp"
+#endif
 
 using namespace std;
 
+// Global type definitions  ///////////////////////////////////////////////////
+
+#ifdef USE_BTREE
+typedef BTreeClass<StudentType> TreeClassType;
+#else
+typedef BSTClass<StudentType> TreeClassType;
+#endif
+
 // Global constant definitioans  //////////////////////////////////////////////
 
 const char ENDLINE_CHAR = '\n';
@@ -57,7 +71,7 @@ void displayCodeChoices();
 int  main()
    {
     StudentType ST_1, removeStudent, retrieveStudent;
-    BSTClass<StudentType> BC_1, BC_2;
+    TreeClassType BC_1, BC_2;
     char studentInfoStr[ MAX_DATA_LEN ];
     int controlCode, inputCtr = 0;
 
@@ -211,7 +225,7 @@ int  main()
               {
                // Non-standard action: Object instantiated in a location
                //   not at the beginning of the function
-               BSTClass<StudentType> BC_3( BC_1 );
+               TreeClassType BC_3( BC_1 );
       
                cout << endl << "BC_3 In Order Traversal: " << endl;
 
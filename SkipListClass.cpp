@@ -0,0 +1,885 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file SkipListClass.cpp
+ *
+ * @brief Implementation file for SkipListClass
+ *
+ * @details Implements all member methods of the SkipListClass
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note Requires SkipListClass.h, BSTEpochManager.o
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef SKIP_LIST_CLASS_CPP
+#define SKIP_LIST_CLASS_CPP
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <new>
+#include "SkipListClass.h"
+
+using namespace std;
+
+/**
+ * @brief SkipListNode create method
+ *
+ * @details Allocates a node with room for its links
+ *
+ * @pre None
+ *
+ * @post Node holds nodeData, every link is NULL and unmarked
+ *
+ * @par Algorithm
+ *      Allocates node and nodeLevel links in one block,
+ *      then constructs both in place
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] nodeData
+ *             DataType item to be stored
+ *
+ * @param [in] nodeLevel
+ *             number of levels the node is linked into
+ *
+ * @return Pointer to new node
+ *
+ * @note Keeping links next to the data saves a cache miss per step
+ */
+template <class DataType>
+SkipListNode<DataType> *SkipListNode<DataType>::create
+   (
+    const DataType &nodeData,     // input: data to be stored
+    int nodeLevel                 // input: number of levels
+   )
+{
+    void *blockPtr = ::operator new( sizeof( SkipListNode<DataType> )
+                                 + nodeLevel * sizeof( atomic<uintptr_t> ) );
+
+    return new ( blockPtr ) SkipListNode<DataType>( nodeData, nodeLevel );
+}
+
+/**
+ * @brief SkipListNode destroy method
+ *
+ * @details Destroys a node made by create
+ *
+ * @pre assumes no thread can still reach the node
+ *
+ * @post Node and its links are freed
+ *
+ * @par Algorithm
+ *      Calls destructor, then frees the block
+ *
+ * @exception None
+ *
+ * @param [in] nodePtr
+ *             node to be destroyed
+ *
+ * @return None
+ *
+ * @note Untyped so it can be handed to BSTEpochManager::retire
+ */
+template <class DataType>
+void SkipListNode<DataType>::destroy
+   (
+    void *nodePtr     // input: node to be destroyed
+   )
+{
+    static_cast<SkipListNode<DataType> *>( nodePtr )->~SkipListNode();
+
+    ::operator delete( nodePtr );
+}
+
+/**
+ * @brief SkipListNode constructor
+ *
+ * @details Constructs node inside block allocated by create
+ *
+ * @pre assumes block has room for nodeLevel links after the node
+ *
+ * @post Node holds nodeData, every link is NULL and unmarked
+ *
+ * @par Algorithm
+ *      Calls initializers, then constructs each link in place
+ *
+ * @exception None
+ *
+ * @param [in] nodeData
+ *             DataType item to be stored
+ *
+ * @param [in] nodeLevel
+ *             number of levels
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+SkipListNode<DataType>::SkipListNode
+   (
+    const DataType &nodeData,     // input: data to be stored
+    int nodeLevel                 // input: number of levels
+   )
+       : dataItem( nodeData ),
+         topLevel( nodeLevel ),
+         finishCount( 0 ),
+         next( reinterpret_cast<atomic<uintptr_t> *>( this + 1 ) )
+{
+    int level;
+
+    for( level = 0; level < topLevel; level++ )
+    {
+        new ( &next[ level ] ) atomic<uintptr_t>( 0 );
+    }
+}
+
+/**
+ * @brief SkipListClass default constructor
+ *
+ * @details Constructs empty SkipListClass
+ *
+ * @pre assumes Uninitialized SkipListClass object
+ *
+ * @post Empty SkipListClass object is initialized
+ *
+ * @par Algorithm
+ *      Creates head node spanning every level
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+SkipListClass<DataType>::SkipListClass
+   (
+    // no parameters
+   )
+       : headNode( SkipListNode<DataType>::create( DataType(), MAX_LEVEL ) )
+{
+    // Initializer used
+}
+
+/**
+ * @brief SkipListClass destructor
+ *
+ * @details Destructs SkipListClass object
+ *
+ * @pre assumes no other thread is using the list
+ *
+ * @post All nodes, including retired ones, are freed
+ *
+ * @par Algorithm
+ *      Calls clear method and frees head node; retired nodes are
+ *      freed by the epoch manager destructor
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note None
+ */
+template <class DataType>
+SkipListClass<DataType>::~SkipListClass
+   (
+    // no parameters
+   )
+{
+    clear();
+
+    SkipListNode<DataType>::destroy( headNode );
+}
+
+/**
+ * @brief Clear method
+ *
+ * @details Clears all data in object
+ *
+ * @pre assumes no other thread is using the list
+ *
+ * @post SkipListClass object is empty
+ *
+ * @par Algorithm
+ *      Frees every node along the bottom level, then clears
+ *      the head links
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Not lock free, like the destructor
+ */
+template <class DataType>
+void SkipListClass<DataType>::clear
+   (
+    // no parameters
+   )
+{
+    SkipListNode<DataType> *workingPtr = getPointer( headNode->next[ 0 ] );
+    SkipListNode<DataType> *nextPtr;
+    int level;
+
+    while( workingPtr != NULL )
+    {
+        nextPtr = getPointer( workingPtr->next[ 0 ] );
+
+        SkipListNode<DataType>::destroy( workingPtr );
+
+        workingPtr = nextPtr;
+    }
+
+    for( level = 0; level < MAX_LEVEL; level++ )
+    {
+        headNode->next[ level ] = 0;
+    }
+}
+
+/**
+ * @brief Insert method
+ *
+ * @details Inserts data in object
+ *
+ * @pre assumes Initialized SkipListClass object
+ *
+ * @post newData is in the list, unless an equal item already was
+ *
+ * @par Algorithm
+ *      Finds the predecessors at every level, links a new node at the
+ *      bottom level with one compare and swap, which makes it present,
+ *      then links it into the upper levels
+ *
+ * @exception bad_alloc if memory is exhausted
+ *
+ * @param [in] newData
+ *             Data to be inserted
+ *
+ * @return None
+ *
+ * @note Lock free, safe to call from any number of threads
+ */
+template <class DataType>
+void SkipListClass<DataType>::insert
+   (
+    const DataType &newData     // input: data to be inserted
+   )
+{
+    SkipListNode<DataType> *preds[ MAX_LEVEL ], *succs[ MAX_LEVEL ];
+    SkipListNode<DataType> *newPtr;
+    BSTEpochGuard epochGuard( epochManager );
+    uintptr_t expected;
+    int level;
+
+    if( findHelper( newData, preds, succs ) )
+    {
+        return;
+    }
+
+    newPtr = SkipListNode<DataType>::create( newData, randomLevel() );
+
+    while( true )
+    {
+        for( level = 0; level < newPtr->topLevel; level++ )
+        {
+            newPtr->next[ level ] = reinterpret_cast<uintptr_t>(
+                                                           succs[ level ] );
+        }
+
+        expected = reinterpret_cast<uintptr_t>( succs[ 0 ] );
+
+        if( preds[ 0 ]->next[ 0 ].compare_exchange_strong( expected,
+                                 reinterpret_cast<uintptr_t>( newPtr ) ) )
+        {
+            break;
+        }
+
+        if( findHelper( newData, preds, succs ) )
+        {
+            // never published, no other thread can hold it
+            SkipListNode<DataType>::destroy( newPtr );
+
+            return;
+        }
+    }
+
+    linkUpperLevels( newPtr, preds, succs );
+
+    finishNode( newPtr );
+}
+
+/**
+ * @brief Find method
+ *
+ * @details Finds data in object
+ *
+ * @pre assumes Initialized SkipListClass object
+ *
+ * @post Know if data exists in list
+ *
+ * @par Algorithm
+ *      Descends from the top level, stepping over nodes marked as
+ *      deleted without unlinking them
+ *
+ * @exception None
+ *
+ * @param [in] searchDataItem
+ *             Data to be searched for
+ *
+ * @return Bool with true for success
+ *
+ * @note Wait free, never writes to shared memory
+ */
+template <class DataType>
+bool SkipListClass<DataType>::find
+   (
+    DataType &searchDataItem     // input: data to be searched for
+   ) const
+{
+    SkipListNode<DataType> *predPtr = headNode, *currPtr;
+    BSTEpochGuard epochGuard( epochManager );
+    uintptr_t succWord;
+    int level, difference;
+
+    for( level = MAX_LEVEL - 1; level >= 0; level-- )
+    {
+        currPtr = getPointer( predPtr->next[ level ] );
+
+        while( currPtr != NULL )
+        {
+            succWord = currPtr->next[ level ];
+
+            if( isMarked( succWord ) )
+            {
+                currPtr = getPointer( succWord );
+            }
+
+            else
+            {
+                difference = searchDataItem.compareTo( currPtr->dataItem );
+
+                if( difference == 0 )
+                {
+                    return true;
+                }
+
+                else if( difference > 0 )
+                {
+                    predPtr = currPtr;
+                    currPtr = getPointer( succWord );
+                }
+
+                else
+                {
+                    currPtr = NULL;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Remove method
+ *
+ * @details Removes data from object
+ *
+ * @pre assumes Initialized SkipListClass object
+ *
+ * @post Data is not in the list
+ *
+ * @par Algorithm
+ *      Marks the node's links from the top level down; the thread whose
+ *      compare and swap marks the bottom link has removed the item,
+ *      then the node is unlinked and retired
+ *
+ * @exception None
+ *
+ * @param [in] dataItem
+ *             Data to be removed
+ *
+ * @return Bool with true for success
+ *
+ * @note Lock free, safe to call from any number of threads
+ */
+template <class DataType>
+bool SkipListClass<DataType>::remove
+   (
+    const DataType &dataItem     // input: data to be removed
+   )
+{
+    SkipListNode<DataType> *preds[ MAX_LEVEL ], *succs[ MAX_LEVEL ];
+    SkipListNode<DataType> *victimPtr;
+    BSTEpochGuard epochGuard( epochManager );
+    uintptr_t oldNext;
+    int level;
+
+    if( !findHelper( dataItem, preds, succs ) )
+    {
+        return false;
+    }
+
+    victimPtr = succs[ 0 ];
+
+    for( level = victimPtr->topLevel - 1; level > 0; level-- )
+    {
+        oldNext = victimPtr->next[ level ];
+
+        while( !isMarked( oldNext ) )
+        {
+            victimPtr->next[ level ].compare_exchange_weak( oldNext,
+                                                      oldNext | MARK_BIT );
+        }
+    }
+
+    oldNext = victimPtr->next[ 0 ];
+
+    while( !isMarked( oldNext ) )
+    {
+        if( victimPtr->next[ 0 ].compare_exchange_strong( oldNext,
+                                                      oldNext | MARK_BIT ) )
+        {
+            finishNode( victimPtr );
+
+            return true;
+        }
+    }
+
+    // another thread removed it first
+    return false;
+}
+
+/**
+ * @brief isEmpty method
+ *
+ * @details Checks if object is empty
+ *
+ * @pre assumes Initialized SkipListClass object
+ *
+ * @post Know if list is empty
+ *
+ * @par Algorithm
+ *      Looks for an unmarked node on the bottom level
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Bool with true if empty
+ *
+ * @note None
+ */
+template <class DataType>
+bool SkipListClass<DataType>::isEmpty
+   (
+    // no parameters
+   ) const
+{
+    SkipListNode<DataType> *workingPtr;
+    BSTEpochGuard epochGuard( epochManager );
+
+    workingPtr = getPointer( headNode->next[ 0 ] );
+
+    while( workingPtr != NULL && isMarked( workingPtr->next[ 0 ] ) )
+    {
+        workingPtr = getPointer( workingPtr->next[ 0 ] );
+    }
+
+    return workingPtr == NULL;
+}
+
+/**
+ * @brief Inorder Traversal
+ *
+ * @details Outputs list in order
+ *
+ * @pre assumes Initialized SkipListClass object
+ *
+ * @post Data in list has been output to screen
+ *
+ * @par Algorithm
+ *      Walks the bottom level, skipping nodes marked as deleted,
+ *      and flushes once at the end
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note Items changed during the walk may or may not be shown
+ */
+template <class DataType>
+void SkipListClass<DataType>::inOrderTraversal
+   (
+    // no parameters
+   ) const
+{
+    char string[ STD_STR_LEN ];
+    SkipListNode<DataType> *workingPtr;
+    BSTEpochGuard epochGuard( epochManager );
+
+    if( isEmpty() )
+    {
+        cout << "Tree is empty" << endl;
+
+        return;
+    }
+
+    workingPtr = getPointer( headNode->next[ 0 ] );
+
+    while( workingPtr != NULL )
+    {
+        if( !isMarked( workingPtr->next[ 0 ] ) )
+        {
+            workingPtr->dataItem.toString( string );
+            cout << string << '\n';
+        }
+
+        workingPtr = getPointer( workingPtr->next[ 0 ] );
+    }
+
+    cout << endl;
+}
+
+/**
+ * @brief Get pointer method
+ *
+ * @details Strips the mark from a link
+ *
+ * @pre None
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Clears the low bit
+ *
+ * @exception None
+ *
+ * @param [in] linkWord
+ *             link value, possibly marked
+ *
+ * @return Node pointed to
+ *
+ * @note None
+ */
+template <class DataType>
+SkipListNode<DataType> *SkipListClass<DataType>::getPointer
+   (
+    uintptr_t linkWord     // input: link value
+   )
+{
+    return reinterpret_cast<SkipListNode<DataType> *>( linkWord & ~MARK_BIT );
+}
+
+/**
+ * @brief Is marked method
+ *
+ * @details Tests the mark of a link
+ *
+ * @pre None
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Tests the low bit
+ *
+ * @exception None
+ *
+ * @param [in] linkWord
+ *             link value
+ *
+ * @return Bool with true if the node owning the link is deleted
+ *         at that level
+ *
+ * @note None
+ */
+template <class DataType>
+bool SkipListClass<DataType>::isMarked
+   (
+    uintptr_t linkWord     // input: link value
+   )
+{
+    return ( linkWord & MARK_BIT ) != 0;
+}
+
+/**
+ * @brief Find helper method
+ *
+ * @details Locates the neighbours of a key at every level
+ *
+ * @pre assumes calling thread is inside an epoch
+ *
+ * @post preds and succs hold, per level, the last node before keyItem
+ *       and the first node not before it
+ *
+ * @par Algorithm
+ *      Descends from the top level; every marked node met on the way
+ *      is unlinked with a compare and swap on its predecessor, and the
+ *      search restarts from the head if that fails
+ *
+ * @exception None
+ *
+ * @param [in] keyItem
+ *             key being located
+ *
+ * @param [out] preds
+ *              predecessor at each level
+ *
+ * @param [out] succs
+ *              successor at each level, NULL past the last node
+ *
+ * @return Bool with true if an unmarked node holds keyItem
+ *
+ * @note None
+ */
+template <class DataType>
+bool SkipListClass<DataType>::findHelper
+   (
+    const DataType &keyItem,               // input: key to locate
+    SkipListNode<DataType> **preds,        // output: predecessors
+    SkipListNode<DataType> **succs         // output: successors
+   )
+{
+    SkipListNode<DataType> *predPtr, *currPtr;
+    uintptr_t currWord, succWord;
+    int level;
+    bool retry = true;
+
+    while( retry )
+    {
+        retry = false;
+        predPtr = headNode;
+
+        for( level = MAX_LEVEL - 1; level >= 0 && !retry; level-- )
+        {
+            currPtr = getPointer( predPtr->next[ level ] );
+
+            while( currPtr != NULL && !retry )
+            {
+                succWord = currPtr->next[ level ];
+
+                if( isMarked( succWord ) )
+                {
+                    currWord = reinterpret_cast<uintptr_t>( currPtr );
+
+                    if( predPtr->next[ level ].compare_exchange_strong(
+                                     currWord, succWord & ~MARK_BIT ) )
+                    {
+                        currPtr = getPointer( succWord );
+                    }
+
+                    else
+                    {
+                        retry = true;
+                    }
+                }
+
+                else if( keyItem.compareTo( currPtr->dataItem ) > 0 )
+                {
+                    predPtr = currPtr;
+                    currPtr = getPointer( succWord );
+                }
+
+                else
+                {
+                    break;
+                }
+            }
+
+            preds[ level ] = predPtr;
+            succs[ level ] = currPtr;
+        }
+    }
+
+    return succs[ 0 ] != NULL
+                          && keyItem.compareTo( succs[ 0 ]->dataItem ) == 0;
+}
+
+/**
+ * @brief Link upper levels method
+ *
+ * @details Links a new node into every level above the bottom
+ *
+ * @pre assumes node is linked at the bottom level, and preds and succs
+ *      come from the search that placed it
+ *
+ * @post Node is linked at every level, or linking stopped because
+ *       the node was removed meanwhile
+ *
+ * @par Algorithm
+ *      For each level, points the node's link at the current successor,
+ *      then swings the predecessor's link to the node; on failure the
+ *      neighbours are searched again; a marked link or a search no
+ *      longer finding the node means it was removed, so linking stops
+ *
+ * @exception None
+ *
+ * @param [in] newPtr
+ *             node being linked
+ *
+ * @param [in] preds
+ *             predecessor at each level
+ *
+ * @param [in] succs
+ *             successor at each level
+ *
+ * @return None
+ *
+ * @note Setting the node's own link with compare and swap keeps a remover
+ *       from marking it between the check and the store
+ */
+template <class DataType>
+void SkipListClass<DataType>::linkUpperLevels
+   (
+    SkipListNode<DataType> *newPtr,        // input: node being linked
+    SkipListNode<DataType> **preds,        // input: predecessors
+    SkipListNode<DataType> **succs         // input: successors
+   )
+{
+    uintptr_t oldNext, expected;
+    int level;
+    bool linked;
+
+    for( level = 1; level < newPtr->topLevel; level++ )
+    {
+        linked = false;
+
+        while( !linked )
+        {
+            oldNext = newPtr->next[ level ];
+
+            if( isMarked( oldNext ) )
+            {
+                return;
+            }
+
+            if( oldNext == reinterpret_cast<uintptr_t>( succs[ level ] )
+                  || newPtr->next[ level ].compare_exchange_strong( oldNext,
+                            reinterpret_cast<uintptr_t>( succs[ level ] ) ) )
+            {
+                expected = reinterpret_cast<uintptr_t>( succs[ level ] );
+
+                linked = preds[ level ]->next[ level ].compare_exchange_strong(
+                             expected, reinterpret_cast<uintptr_t>( newPtr ) );
+
+                if( !linked )
+                {
+                    findHelper( newPtr->dataItem, preds, succs );
+
+                    if( succs[ 0 ] != newPtr )
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Finish node method
+ *
+ * @details Retires a removed node once its inserter is done with it
+ *
+ * @pre assumes calling thread is inside an epoch, and is the node's
+ *      inserter after linking or its remover after marking
+ *
+ * @post Node is retired if both are done
+ *
+ * @par Algorithm
+ *      The second of the two callers runs one more search for the key,
+ *      which unlinks the node at every level it was linked into, then
+ *      hands it to the epoch manager
+ *
+ * @exception None
+ *
+ * @param [in] nodePtr
+ *             node inserted or removed by the caller
+ *
+ * @return None
+ *
+ * @note An inserter still linking upper levels could otherwise make a
+ *       retired node reachable again
+ */
+template <class DataType>
+void SkipListClass<DataType>::finishNode
+   (
+    SkipListNode<DataType> *nodePtr     // input: node finished with
+   )
+{
+    SkipListNode<DataType> *preds[ MAX_LEVEL ], *succs[ MAX_LEVEL ];
+
+    if( nodePtr->finishCount.fetch_add( 1 ) == 1 )
+    {
+        findHelper( nodePtr->dataItem, preds, succs );
+
+        epochManager.retire( nodePtr, SkipListNode<DataType>::destroy );
+    }
+}
+
+/**
+ * @brief Random level method
+ *
+ * @details Picks the number of levels for a new node
+ *
+ * @pre None
+ *
+ * @post None
+ *
+ * @par Algorithm
+ *      Each further level is taken with probability 1/4, using a
+ *      per thread xorshift generator
+ *
+ * @exception None
+ *
+ * @param None
+ *
+ * @return Level from 1 to MAX_LEVEL
+ *
+ * @note Probability 1/4 averages 1.33 links per node
+ */
+template <class DataType>
+int SkipListClass<DataType>::randomLevel
+   (
+    // no parameters
+   ) const
+{
+    static thread_local unsigned int randomState = 0;
+    unsigned int randomBits;
+    int level = 1;
+
+    if( randomState == 0 )
+    {
+        randomState = static_cast<unsigned int>(
+                        reinterpret_cast<uintptr_t>( &randomState ) ) | 1;
+    }
+
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    randomBits = randomState;
+
+    while( level < MAX_LEVEL && ( randomBits & 3 ) == 0 )
+    {
+        level++;
+
+        randomBits >>= 2;
+    }
+
+    return level;
+}
+
+#endif  // define SKIP_LIST_CLASS_CPP
+
@@ -0,0 +1,120 @@
+// Program Information ////////////////////////////////////////////////////////
+/**
+ * @file SkipListClass.h
+ *
+ * @brief Definition file for SkipListClass
+ *
+ * @details Specifies all member methods of the SkipListClass,
+ *          a lock free ordered set with the insert, find and remove
+ *          interface of BSTClass
+ *
+ * @version 1.00 (16 October 2026)
+ *
+ * @Note None
+ */
+
+// Precompiler directives /////////////////////////////////////////////////////
+
+#ifndef SKIP_LIST_CLASS_H
+#define SKIP_LIST_CLASS_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include "BSTEpochManager.h"
+
+using namespace std;
+
+// Class constants ////////////////////////////////////////////////////////////
+
+   // None
+
+// Class definition ///////////////////////////////////////////////////////////
+
+template <typename DataType>
+class SkipListNode
+   {
+    public:
+
+       // constants
+       static const int MAX_LEVEL = 16;
+       static const uintptr_t MARK_BIT = 1;
+
+       static SkipListNode<DataType> *create( const DataType &nodeData,
+                                                              int nodeLevel );
+
+       static void destroy( void *nodePtr );
+
+       DataType dataItem;
+
+       int topLevel;
+
+       // inserter and remover each add one when done with the node
+       atomic<int> finishCount;
+
+       // topLevel links stored just after the node, the low bit of a link
+       // marks this node as deleted at that level
+       atomic<uintptr_t> *next;
+
+    private:
+
+       SkipListNode( const DataType &nodeData, int nodeLevel );
+   };
+
+template <typename DataType>
+class SkipListClass
+   {
+    public:
+
+       // constants
+       static const int STD_STR_LEN = 50;
+       static const int MAX_LEVEL = SkipListNode<DataType>::MAX_LEVEL;
+       static const uintptr_t MARK_BIT = SkipListNode<DataType>::MARK_BIT;
+
+       // constructor
+       SkipListClass();
+
+       // destructor
+       ~SkipListClass();
+
+       // modifiers
+       void clear();
+       void insert( const DataType &newData );
+       bool find( DataType &searchDataItem ) const;
+       bool remove( const DataType &dataItem );
+
+       // accessors
+       bool isEmpty() const;
+       void inOrderTraversal() const;
+
+    private:
+
+       // not copyable, nodes may be in use by other threads
+       SkipListClass( const SkipListClass<DataType> &copied );
+       const SkipListClass &operator = ( const SkipListClass<DataType> &rhData );
+
+       static SkipListNode<DataType> *getPointer( uintptr_t linkWord );
+
+       static bool isMarked( uintptr_t linkWord );
+
+       bool findHelper( const DataType &keyItem,
+                                  SkipListNode<DataType> **preds,
+                                  SkipListNode<DataType> **succs );
+
+       void linkUpperLevels( SkipListNode<DataType> *newPtr,
+                                  SkipListNode<DataType> **preds,
+                                  SkipListNode<DataType> **succs );
+
+       void finishNode( SkipListNode<DataType> *nodePtr );
+
+       int randomLevel() const;
+
+       SkipListNode<DataType> *headNode;
+
+       mutable BSTEpochManager epochManager;
+   };
+
+#endif	// define SKIP_LIST_CLASS_H
+
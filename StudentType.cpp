@@ -26,6 +26,7 @@
 
 #include "StudentType.h"
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 
 using namespace std;
@@ -98,6 +99,65 @@ StudentType::StudentType
     copyString( name, initStudentName );
    }
 
+/**
+ * @brief Copy constructor
+ *
+ * @details Constructs StudentType as copy of other object
+ *          
+ * @pre assumes uninitialized StudentType object
+ *
+ * @post Initializes all data quantities from copied object
+ *
+ * @par Algorithm 
+ *      Calls copyStudent
+ * 
+ * @exception None
+ *
+ * @param [in] copied
+ *             other StudentType object to be copied
+ *
+ * @return None
+ *
+ * @note None
+ */
+StudentType::StudentType
+     ( 
+      const StudentType &copied
+     )
+   {
+    copyStudent( copied );
+   }
+
+/**
+ * @brief Move constructor
+ *
+ * @details Constructs StudentType from a temporary object
+ *          
+ * @pre assumes uninitialized StudentType object
+ *
+ * @post Initializes all data quantities from moved object
+ *
+ * @par Algorithm 
+ *      Calls copyStudent, all data is held in place so
+ *      there is nothing to take over
+ * 
+ * @exception None
+ *
+ * @param [in] moved
+ *             other StudentType object to be moved
+ *
+ * @return None
+ *
+ * @note Declared noexcept so containers move rather than copy
+ */
+StudentType::StudentType
+     ( 
+      StudentType &&moved
+     ) noexcept
+   {
+    copyStudent( moved );
+   }
+
 /**
  * @brief Assignment operation
  *
@@ -108,7 +168,7 @@ StudentType::StudentType
  * @post desination object holds copy of local this object
  *
  * @par Algorithm 
- *      Copies each data item separately
+ *      Calls copyStudent
  * 
  * @exception None
  *
@@ -124,11 +184,44 @@ const StudentType &StudentType:: operator =
       const StudentType &rhStudent 
      )
    {
-    copyString( name, rhStudent.name );
+    if( this != &rhStudent )
+       {
+        copyStudent( rhStudent );
+       }
 
-    universityID = rhStudent.universityID;
+    return *this;
+   }
 
-    gender = rhStudent.gender;
+/**
+ * @brief Move assignment operation
+ *
+ * @details Class overloaded assignment operator for temporaries
+ *          
+ * @pre assumes initialized other object
+ *
+ * @post desination object holds copy of local this object
+ *
+ * @par Algorithm 
+ *      Calls copyStudent
+ * 
+ * @exception None
+ *
+ * @param [in] rhStudent
+ *             other StudentType object to be moved
+ *
+ * @return Reference to local this StudentType object
+ *
+ * @note Declared noexcept so containers move rather than copy
+ */
+const StudentType &StudentType:: operator = 
+     ( 
+      StudentType &&rhStudent 
+     ) noexcept
+   {
+    if( this != &rhStudent )
+       {
+        copyStudent( rhStudent );
+       }
 
     return *this;
    }
@@ -301,6 +394,40 @@ void StudentType::copyString
        }
    }
 
+/**
+ * @brief Object copy utility
+ *
+ * @details Copies all data of source object into this object
+ *          
+ * @pre assumes source name is terminated within STD_STR_LEN
+ *
+ * @post this object holds copy of source object
+ *
+ * @par Algorithm 
+ *      Copies whole name array in one block rather than
+ *      character by character, then the remaining data items
+ * 
+ * @exception None
+ *
+ * @param [in] source
+ *             StudentType object to be copied
+ *
+ * @return None
+ *
+ * @note None
+ */
+void StudentType::copyStudent
+     (
+      const StudentType &source
+     )
+   {
+    memcpy( name, source.name, STD_STR_LEN );
+
+    universityID = source.universityID;
+
+    gender = source.gender;
+   }
+
 /**
  * @brief Name parsing utility
  *
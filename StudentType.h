@@ -49,8 +49,13 @@ class StudentType
        // initialization constructor
        StudentType( char *initStudentName, int initUnivIDNum, char initGender );
 
+       // copy and move constructors
+       StudentType( const StudentType &copied );
+       StudentType( StudentType &&moved ) noexcept;
+
        // assignment operator - required by Simple/UtilityVector
        const StudentType &operator = ( const StudentType &rhStudent );
+       const StudentType &operator = ( StudentType &&rhStudent ) noexcept;
 
        // data setting operation
        void setStudentData( char *inStudentName, 
@@ -74,6 +79,7 @@ class StudentType
        char gender;
 
        void copyString( char *destination, const char *source ) const;
+       void copyStudent( const StudentType &source );
        void parseNames( char *lastName, char *firstName, 
                                                  const char *fullName ) const;
        int compareStrings( const char *oneStr, const char *otherStr ) const;